@@ -23,6 +23,7 @@
 #include "audio/fmopl.h"
 
 #include "audio/mixer.h"
+#include "audio/renderahead.h"
 #include "audio/softsynth/opl/dosbox.h"
 #include "audio/softsynth/opl/mame.h"
 #include "audio/softsynth/opl/nuked.h"
@@ -293,7 +294,8 @@ EmulatedOPL::EmulatedOPL() :
 	_nextTick(0),
 	_samplesPerTick(0),
 	_baseFreq(0),
-	_handle(new Audio::SoundHandle()) {
+	_handle(new Audio::SoundHandle()),
+	_renderAhead(nullptr) {
 }
 
 EmulatedOPL::~EmulatedOPL() {
@@ -307,6 +309,14 @@ EmulatedOPL::~EmulatedOPL() {
 }
 
 int EmulatedOPL::readBuffer(int16 *buffer, const int numSamples) {
+	if (_renderAhead)
+		return _renderAhead->readBuffer(buffer, numSamples);
+
+	renderSamples(buffer, numSamples);
+	return numSamples;
+}
+
+void EmulatedOPL::renderSamples(int16 *buffer, int numSamples) {
 	const int stereoFactor = isStereo() ? 2 : 1;
 	int len = numSamples / stereoFactor;
 	int step;
@@ -329,8 +339,6 @@ int EmulatedOPL::readBuffer(int16 *buffer, const int numSamples) {
 		buffer += step * stereoFactor;
 		len -= step;
 	} while (len);
-
-	return numSamples;
 }
 
 int EmulatedOPL::getRate() const {
@@ -339,11 +347,19 @@ int EmulatedOPL::getRate() const {
 
 void EmulatedOPL::startCallbacks(int timerFrequency) {
 	setCallbackFrequency(timerFrequency);
+
+	_renderAhead = Audio::RenderAheadBuffer::create(new Common::Functor2Mem<int16 *, int, void, EmulatedOPL>(this, &EmulatedOPL::renderSamples), getRate(), isStereo());
+	if (_renderAhead)
+		_renderAhead->start();
+
 	g_system->getMixer()->playStream(Audio::Mixer::kPlainSoundType, _handle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 }
 
 void EmulatedOPL::stopCallbacks() {
 	g_system->getMixer()->stopHandle(*_handle);
+
+	delete _renderAhead;
+	_renderAhead = nullptr;
 }
 
 void EmulatedOPL::setCallbackFrequency(int timerFrequency) {
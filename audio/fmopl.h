@@ -30,6 +30,7 @@
 #include "common/scummsys.h"
 
 namespace Audio {
+class RenderAheadBuffer;
 class SoundHandle;
 }
 
@@ -268,6 +269,12 @@ protected:
 	virtual void generateSamples(int16 *buffer, int numSamples) = 0;
 
 private:
+	/**
+	 * Generate samples and invoke the timer callback at the proper
+	 * sample positions.
+	 */
+	void renderSamples(int16 *buffer, int numSamples);
+
 	int _baseFreq;
 
 	enum {
@@ -278,6 +285,7 @@ private:
 	int _samplesPerTick;
 
 	Audio::SoundHandle *_handle;
+	Audio::RenderAheadBuffer *_renderAhead;
 };
 
 } // End of namespace OPL
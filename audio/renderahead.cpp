@@ -0,0 +1,190 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/renderahead.h"
+
+#include "common/array.h"
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/system.h"
+#include "common/timer.h"
+#include "common/util.h"
+
+namespace Audio {
+
+namespace {
+
+/**
+ * All buffers currently rendering ahead. They share a single timer proc,
+ * since the timer manager removes procs by address. The timer proc stays
+ * installed once started: removing it would wait for all other timer procs
+ * as well, and stop() may not wait for more than the render procedures.
+ */
+struct RenderAheadRegistry {
+	Common::Mutex mutex;
+	Common::Array<RenderAheadBuffer *> buffers;
+};
+
+RenderAheadRegistry *s_registry = nullptr;
+
+void renderAheadTimerProc(void *refCon) {
+	RenderAheadRegistry *registry = (RenderAheadRegistry *)refCon;
+
+	Common::StackLock lock(registry->mutex);
+	for (uint i = 0; i < registry->buffers.size(); ++i)
+		registry->buffers[i]->fill();
+}
+
+} // End of anonymous namespace
+
+RenderAheadBuffer::RenderAheadBuffer(RenderProc *render, int rate, int numSamples, bool stereo)
+	: _render(render), _channels(stereo ? 2 : 1), _readPos(0), _writePos(0), _filled(0),
+	  _underrunCount(0), _active(false) {
+	assert(_render);
+
+	// Keep the ring aligned to whole sample frames, so that stereo data never
+	// wraps between the left and right channel.
+	_size = MAX<int>(numSamples, kChunkSize) / _channels * _channels;
+	_buffer = new int16[_size];
+
+	// The timer proc runs every 10 ms, so this leaves room for catching up
+	// after a late tick without rendering a whole ring at once.
+	_maxSamplesPerTick = MAX<int>(rate * kMaxMillisecondsPerTick / 1000 * _channels, kChunkSize);
+}
+
+RenderAheadBuffer::~RenderAheadBuffer() {
+	stop();
+
+	if (_underrunCount)
+		debug(1, "Render-ahead buffer ran out of samples %u times", _underrunCount);
+
+	delete[] _buffer;
+	delete _render;
+}
+
+RenderAheadBuffer *RenderAheadBuffer::create(RenderProc *render, int rate, bool stereo) {
+	const int milliseconds = ConfMan.getInt("audio_render_ahead");
+	if (milliseconds <= 0) {
+		delete render;
+		return nullptr;
+	}
+
+	const int numSamples = rate * milliseconds / 1000 * (stereo ? 2 : 1);
+	debug(1, "Rendering %d ms of audio ahead (%d samples)", milliseconds, numSamples);
+	return new RenderAheadBuffer(render, rate, numSamples, stereo);
+}
+
+void RenderAheadBuffer::start() {
+	if (_active)
+		return;
+
+	// Prime the ring, so the first mixer callback does not underrun. The
+	// timer proc is not running for this buffer yet, so the mixer is the
+	// only other thread accessing it.
+	render(_size);
+
+	if (!s_registry) {
+		s_registry = new RenderAheadRegistry();
+		g_system->getTimerManager()->installTimerProc(&renderAheadTimerProc, 10000, s_registry, "RenderAhead");
+	}
+
+	Common::StackLock lock(s_registry->mutex);
+	s_registry->buffers.push_back(this);
+	_active = true;
+}
+
+void RenderAheadBuffer::stop() {
+	if (!_active)
+		return;
+
+	assert(s_registry);
+
+	// Waits for the timer proc if it is rendering, see the header
+	Common::StackLock lock(s_registry->mutex);
+	for (uint i = 0; i < s_registry->buffers.size(); ++i) {
+		if (s_registry->buffers[i] == this) {
+			s_registry->buffers.remove_at(i);
+			break;
+		}
+	}
+
+	_active = false;
+}
+
+void RenderAheadBuffer::fill() {
+	render(_maxSamplesPerTick);
+}
+
+void RenderAheadBuffer::render(int maxSamples) {
+	while (maxSamples > 0) {
+		int writePos, space;
+		{
+			Common::StackLock lock(_bufferMutex);
+			writePos = _writePos;
+			space = _size - _filled;
+		}
+
+		// Only the free part of the ring is written here, which readBuffer
+		// never touches, so rendering happens without the buffer lock held.
+		int len = MIN<int>(MIN<int>(space, _size - writePos), MIN<int>(maxSamples, kChunkSize));
+		len = len / _channels * _channels;
+		if (len <= 0)
+			break;
+
+		(*_render)(_buffer + writePos, len);
+		maxSamples -= len;
+
+		Common::StackLock lock(_bufferMutex);
+		_writePos = (writePos + len) % _size;
+		_filled += len;
+	}
+}
+
+int RenderAheadBuffer::copyOut(int16 *buffer, int numSamples) {
+	Common::StackLock lock(_bufferMutex);
+
+	int copied = 0;
+	while (copied < numSamples && _filled > 0) {
+		const int len = MIN<int>(MIN<int>(numSamples - copied, _filled), _size - _readPos);
+		memcpy(buffer + copied, _buffer + _readPos, len * sizeof(int16));
+
+		_readPos = (_readPos + len) % _size;
+		_filled -= len;
+		copied += len;
+	}
+
+	return copied;
+}
+
+int RenderAheadBuffer::readBuffer(int16 *buffer, const int numSamples) {
+	const int copied = copyOut(buffer, numSamples);
+	if (copied < numSamples) {
+		// Waiting for the timer thread to render the missing samples could
+		// deadlock, see the class description.
+		memset(buffer + copied, 0, (numSamples - copied) * sizeof(int16));
+		++_underrunCount;
+	}
+
+	return numSamples;
+}
+
+} // End of namespace Audio
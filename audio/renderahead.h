@@ -0,0 +1,140 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_RENDERAHEAD_H
+#define AUDIO_RENDERAHEAD_H
+
+#include "common/scummsys.h"
+#include "common/func.h"
+#include "common/mutex.h"
+#include "common/noncopyable.h"
+
+namespace Audio {
+
+/**
+ * A ring buffer which renders the output of an emulated synthesizer ahead
+ * of the mixer.
+ *
+ * The render procedure is called from the timer thread in small chunks,
+ * so the mixer callback only has to copy already rendered samples. Since
+ * the render procedure is the same one the mixer would otherwise call, any
+ * callbacks it triggers keep their exact sample positions; they just happen
+ * earlier in wall-clock time.
+ *
+ * The mixer callback never waits for the render procedure, since the
+ * callbacks it triggers may lock engine mutexes which are held while
+ * calling into the mixer. If the ring runs dry the missing samples are
+ * output as silence, and the music continues where it left off.
+ */
+class RenderAheadBuffer : Common::NonCopyable {
+public:
+	/**
+	 * Procedure producing the samples. It is called with a buffer and the
+	 * number of samples to write, following the AudioStream::readBuffer
+	 * conventions for stereo data.
+	 */
+	typedef Common::Functor2<int16 *, int, void> RenderProc;
+
+	/**
+	 * Create a new buffer.
+	 *
+	 * @param render	the render procedure, the buffer takes ownership
+	 * @param rate	the sample rate of the rendered data
+	 * @param numSamples	capacity of the ring in samples
+	 * @param stereo	whether the rendered data is interleaved stereo
+	 */
+	RenderAheadBuffer(RenderProc *render, int rate, int numSamples, bool stereo);
+	/**
+	 * Stops rendering ahead, with the same requirements as stop().
+	 */
+	~RenderAheadBuffer();
+
+	/**
+	 * Create a buffer according to the "audio_render_ahead" setting, which
+	 * holds the render-ahead length in milliseconds.
+	 *
+	 * @return the new buffer, or 0 if render-ahead is disabled. In the latter
+	 *         case the render procedure is deleted.
+	 */
+	static RenderAheadBuffer *create(RenderProc *render, int rate, bool stereo);
+
+	/**
+	 * Start rendering ahead from the timer thread.
+	 */
+	void start();
+
+	/**
+	 * Stop rendering ahead. Once this returns the render procedure is no
+	 * longer invoked by the timer thread.
+	 *
+	 * This waits for the timer thread to finish rendering, so it must not
+	 * be called with a lock held which the render procedure or the driver
+	 * callbacks it triggers take. Stopping the driver's stream with
+	 * Mixer::stopHandle() has the same requirement, since the mixer calls
+	 * the render procedure with its own lock held when not rendering ahead.
+	 */
+	void stop();
+
+	/**
+	 * Render into the ring until it is full, but no more than the timer
+	 * thread should render per tick.
+	 */
+	void fill();
+
+	/**
+	 * Read samples from the ring, padding any missing ones with silence.
+	 */
+	int readBuffer(int16 *buffer, const int numSamples);
+
+private:
+	enum {
+		kChunkSize = 512,
+		/**
+		 * Each timer tick renders at most this many milliseconds of audio,
+		 * so that other timer procs are not held up for long.
+		 */
+		kMaxMillisecondsPerTick = 20
+	};
+
+	void render(int maxSamples);
+	int copyOut(int16 *buffer, int numSamples);
+
+	RenderProc *_render;
+	int16 *_buffer;
+	int _size;
+	int _channels;
+	int _maxSamplesPerTick;
+
+	int _readPos;
+	int _writePos;
+	int _filled;
+
+	uint32 _underrunCount;
+	bool _active;
+
+	/** Protects the ring positions */
+	Common::Mutex _bufferMutex;
+};
+
+} // End of namespace Audio
+
+#endif
@@ -26,6 +26,7 @@
 #include "audio/audiostream.h"
 #include "audio/mididrv.h"
 #include "audio/mixer.h"
+#include "audio/renderahead.h"
 
 class MidiDriver_Emulated : public Audio::AudioStream, public MidiDriver {
 protected:
@@ -44,12 +45,61 @@ private:
 	int _nextTick;
 	int _samplesPerTick;
 
+	Audio::RenderAheadBuffer *_renderAhead;
+
+	void renderSamples(int16 *data, int numSamples) {
+		const int stereoFactor = isStereo() ? 2 : 1;
+		int len = numSamples / stereoFactor;
+		int step;
+
+		do {
+			step = len;
+			if (step > (_nextTick >> FIXP_SHIFT))
+				step = (_nextTick >> FIXP_SHIFT);
+
+			generateSamples(data, step);
+
+			_nextTick -= step << FIXP_SHIFT;
+			if (!(_nextTick >> FIXP_SHIFT)) {
+				if (_timerProc)
+					(*_timerProc)(_timerParam);
+
+				onTimer();
+
+				_nextTick += _samplesPerTick;
+			}
+
+			data += step * stereoFactor;
+			len -= step;
+		} while (len);
+	}
+
 protected:
 	int _baseFreq;
 
 	virtual void generateSamples(int16 *buf, int len) = 0;
 	virtual void onTimer() {}
 
+	/**
+	 * Start rendering samples ahead of the mixer, if enabled by the
+	 * "audio_render_ahead" setting. Subclasses with an expensive
+	 * generateSamples() should call this before starting the stream.
+	 */
+	void startRenderAhead() {
+		_renderAhead = Audio::RenderAheadBuffer::create(new Common::Functor2Mem<int16 *, int, void, MidiDriver_Emulated>(this, &MidiDriver_Emulated::renderSamples), getRate(), isStereo());
+		if (_renderAhead)
+			_renderAhead->start();
+	}
+
+	/**
+	 * Stop rendering ahead. Needs to be called after the stream has been
+	 * stopped, but before the synthesizer is shut down.
+	 */
+	void stopRenderAhead() {
+		delete _renderAhead;
+		_renderAhead = nullptr;
+	}
+
 public:
 	MidiDriver_Emulated(Audio::Mixer *mixer) :
 		_mixer(mixer),
@@ -58,9 +108,14 @@ public:
 		_timerParam(0),
 		_nextTick(0),
 		_samplesPerTick(0),
+		_renderAhead(nullptr),
 		_baseFreq(250) {
 	}
 
+	virtual ~MidiDriver_Emulated() {
+		stopRenderAhead();
+	}
+
 	// MidiDriver API
 	virtual int open() {
 		_isOpen = true;
@@ -89,31 +144,10 @@ public:
 
 	// AudioStream API
 	virtual int readBuffer(int16 *data, const int numSamples) {
-		const int stereoFactor = isStereo() ? 2 : 1;
-		int len = numSamples / stereoFactor;
-		int step;
-
-		do {
-			step = len;
-			if (step > (_nextTick >> FIXP_SHIFT))
-				step = (_nextTick >> FIXP_SHIFT);
-
-			generateSamples(data, step);
-
-			_nextTick -= step << FIXP_SHIFT;
-			if (!(_nextTick >> FIXP_SHIFT)) {
-				if (_timerProc)
-					(*_timerProc)(_timerParam);
-
-				onTimer();
-
-				_nextTick += _samplesPerTick;
-			}
-
-			data += step * stereoFactor;
-			len -= step;
-		} while (len);
+		if (_renderAhead)
+			return _renderAhead->readBuffer(data, numSamples);
 
+		renderSamples(data, numSamples);
 		return numSamples;
 	}
 
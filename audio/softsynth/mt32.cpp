@@ -221,6 +221,7 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	startRenderAhead();
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -270,6 +271,7 @@ void MidiDriver_MT32::close() {
 	setTimerCallback(NULL, NULL);
 	// Detach the mixer callback handler
 	_mixer->stopHandle(_mixerSoundHandle);
+	stopRenderAhead();
 
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
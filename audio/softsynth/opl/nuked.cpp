@@ -699,6 +699,7 @@ static void OPL3_ChannelUpdateRhythm(opl3_chip *chip, Bit8u data)
     Bit8u chnum;
 
     chip->rhy = data & 0x3f;
+    chip->mixdirty = 1;
     if (chip->rhy & 0x20)
     {
         channel6 = &chip->channel[6];
@@ -827,6 +828,7 @@ static void OPL3_ChannelWriteB0(opl3_channel *channel, Bit8u data)
 
 static void OPL3_ChannelSetupAlg(opl3_channel *channel)
 {
+    channel->chip->mixdirty = 1;
     if (channel->chtype == ch_drum)
     {
         if (channel->ch_num == 7 || channel->ch_num == 8)
@@ -963,6 +965,7 @@ static void OPL3_ChannelWriteC0(opl3_channel *channel, Bit8u data)
     {
         channel->cha = channel->chb = (Bit16u)~0;
     }
+    channel->chip->mixdirty = 1;
 }
 
 static void OPL3_ChannelKeyOn(opl3_channel *channel)
@@ -1050,13 +1053,74 @@ static Bit16s OPL3_ClipSample(Bit32s sample)
     return (Bit16s)sample;
 }
 
-void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
+// Rebuild the lists of channel outputs that are mixed into each side. Muted
+// channels and outputs pointing to zeromod do not change the sum, so this is
+// bit-exact with summing all 4 outputs of all 18 channels.
+static void OPL3_UpdateMixList(opl3_chip *chip)
+{
+    Bit8u ii;
+    Bit8u jj;
+    Bit8u side;
+    Bit16u mask;
+    opl3_mixchannel *mix;
+
+    for (side = 0; side < 2; side++)
+    {
+        chip->mixchcnt[side] = 0;
+        for (ii = 0; ii < 18; ii++)
+        {
+            mask = side ? chip->channel[ii].chb : chip->channel[ii].cha;
+            if (!mask)
+            {
+                continue;
+            }
+            mix = &chip->mixch[side][chip->mixchcnt[side]];
+            mix->outcnt = 0;
+            for (jj = 0; jj < 4; jj++)
+            {
+                if (chip->channel[ii].out[jj] != &chip->zeromod)
+                {
+                    mix->out[mix->outcnt++] = chip->channel[ii].out[jj];
+                }
+            }
+            if (mix->outcnt)
+            {
+                chip->mixchcnt[side]++;
+            }
+        }
+    }
+    chip->mixdirty = 0;
+}
+
+static Bit32s OPL3_MixChannels(const opl3_mixchannel *mix, Bit8u count)
 {
     Bit8u ii;
     Bit8u jj;
     Bit16s accm;
+    Bit32s sum = 0;
+
+    for (ii = 0; ii < count; ii++)
+    {
+        accm = 0;
+        for (jj = 0; jj < mix[ii].outcnt; jj++)
+        {
+            accm += *mix[ii].out[jj];
+        }
+        sum += accm;
+    }
+    return sum;
+}
+
+void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
+{
+    Bit8u ii;
     Bit8u shift = 0;
 
+    if (chip->mixdirty)
+    {
+        OPL3_UpdateMixList(chip);
+    }
+
     buf[1] = OPL3_ClipSample(chip->mixbuff[1]);
 
     for (ii = 0; ii < 15; ii++)
@@ -1067,16 +1131,7 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
         OPL3_SlotGenerate(&chip->slot[ii]);
     }
 
-    chip->mixbuff[0] = 0;
-    for (ii = 0; ii < 18; ii++)
-    {
-        accm = 0;
-        for (jj = 0; jj < 4; jj++)
-        {
-            accm += *chip->channel[ii].out[jj];
-        }
-        chip->mixbuff[0] += (Bit16s)(accm & chip->channel[ii].cha);
-    }
+    chip->mixbuff[0] = OPL3_MixChannels(chip->mixch[0], chip->mixchcnt[0]);
 
     for (ii = 15; ii < 18; ii++)
     {
@@ -1096,16 +1151,7 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
         OPL3_SlotGenerate(&chip->slot[ii]);
     }
 
-    chip->mixbuff[1] = 0;
-    for (ii = 0; ii < 18; ii++)
-    {
-        accm = 0;
-        for (jj = 0; jj < 4; jj++)
-        {
-            accm += *chip->channel[ii].out[jj];
-        }
-        chip->mixbuff[1] += (Bit16s)(accm & chip->channel[ii].chb);
-    }
+    chip->mixbuff[1] = OPL3_MixChannels(chip->mixch[1], chip->mixchcnt[1]);
 
     for (ii = 33; ii < 36; ii++)
     {
@@ -1138,7 +1184,9 @@ void OPL3_Generate(opl3_chip *chip, Bit16s *buf)
     chip->eg_add = 0;
     if (chip->eg_timer)
     {
-        while (shift < 36 && ((chip->eg_timer >> shift) & 1) == 0)
+        // Any shift above 12 results in no increment, so there is no need
+        // to scan further than that.
+        while (shift < 13 && ((chip->eg_timer >> shift) & 1) == 0)
         {
             shift++;
         }
@@ -1240,6 +1288,7 @@ void OPL3_Reset(opl3_chip *chip, Bit32u samplerate)
         OPL3_ChannelSetupAlg(&chip->channel[channum]);
     }
     chip->noise = 1;
+    chip->mixdirty = 1;
     chip->rateratio = (samplerate << RSM_FRAC) / 49716;
     chip->tremoloshift = 4;
     chip->vibshift = 1;
@@ -103,6 +103,13 @@ struct _opl3_channel {
     Bit8u ch_num;
 };
 
+// Channel outputs which actually contribute to one side of the mix, with
+// the outputs hardwired to zero left out.
+typedef struct _opl3_mixchannel {
+    Bit16s *out[4];
+    Bit8u outcnt;
+} opl3_mixchannel;
+
 typedef struct _opl3_writebuf {
     Bit64u time;
     Bit16u reg;
@@ -128,6 +135,9 @@ struct _opl3_chip {
     Bit32u noise;
     Bit16s zeromod;
     Bit32s mixbuff[2];
+    opl3_mixchannel mixch[2][18];
+    Bit8u mixchcnt[2];
+    Bit8u mixdirty;
     Bit8u rm_hh_bit2;
     Bit8u rm_hh_bit3;
     Bit8u rm_hh_bit7;
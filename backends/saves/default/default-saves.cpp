@@ -41,6 +41,8 @@
 #include "common/fs.h"
 #include "common/archive.h"
 #include "common/config-manager.h"
+#include "common/memstream.h"
+#include "common/system.h"
 #include "common/zlib.h"
 
 #ifndef _WIN32_WCE
@@ -51,13 +53,78 @@
 const char *DefaultSaveFileManager::TIMESTAMPS_FILENAME = "timestamps";
 #endif
 
-DefaultSaveFileManager::DefaultSaveFileManager() {
+/** Suffix of the temporary files background saves are written to */
+static const char *const kPartialSaveSuffix = ".partial";
+/** Suffix a savefile is renamed to while it is replaced */
+static const char *const kReplacedSaveSuffix = ".replaced";
+
+/**
+ * Collects the data of a background save in memory, and hands it over to
+ * the savefile manager once finalized or deleted.
+ */
+class BackgroundSaveStream : public Common::WriteStream {
+public:
+	BackgroundSaveStream(DefaultSaveFileManager *manager, DefaultSaveFileManager::PendingSave *save)
+		: _manager(manager), _save(save), _buffer(new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO)), _size(0) {}
+
+	virtual ~BackgroundSaveStream() {
+		queue();
+	}
+
+	virtual uint32 write(const void *dataPtr, uint32 dataSize) {
+		// Once queued, the data belongs to the savefile manager
+		if (!_save)
+			return 0;
+		return _buffer->write(dataPtr, dataSize);
+	}
+
+	virtual bool err() const { return false; }
+	virtual void clearErr() {}
+	virtual void finalize() { queue(); }
+	virtual int32 pos() const { return _buffer ? _buffer->pos() : _size; }
+
+private:
+	void queue() {
+		if (!_save)
+			return;
+
+		_save->data = _buffer->getData();
+		_save->size = _size = _buffer->size();
+		delete _buffer;
+		_buffer = nullptr;
+
+		_manager->queueSave(_save);
+		_save = nullptr;
+	}
+
+	DefaultSaveFileManager *_manager;
+	DefaultSaveFileManager::PendingSave *_save;
+	Common::MemoryWriteStreamDynamic *_buffer;
+	uint32 _size;
+};
+
+/**
+ * OutSaveFile for background saves. Saves are synced to the cloud after
+ * they were written, not when they are finalized.
+ */
+class BackgroundOutSaveFile : public Common::OutSaveFile {
+public:
+	BackgroundOutSaveFile(Common::WriteStream *w) : Common::OutSaveFile(w) {}
+
+	virtual void finalize() { _wrapped->finalize(); }
+};
+
+DefaultSaveFileManager::DefaultSaveFileManager() : _savesWritten(false) {
 }
 
-DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath) {
+DefaultSaveFileManager::DefaultSaveFileManager(const Common::String &defaultSavepath) : _savesWritten(false) {
 	ConfMan.registerDefault("savepath", defaultSavepath);
 }
 
+DefaultSaveFileManager::~DefaultSaveFileManager() {
+	finishSaves();
+}
+
 
 void DefaultSaveFileManager::checkPath(const Common::FSNode &dir) {
 	clearError();
@@ -97,6 +164,8 @@ Common::StringArray DefaultSaveFileManager::listSavefiles(const Common::String &
 }
 
 Common::InSaveFile *DefaultSaveFileManager::openRawFile(const Common::String &filename) {
+	finishSaves(&filename);
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -113,6 +182,8 @@ Common::InSaveFile *DefaultSaveFileManager::openRawFile(const Common::String &fi
 }
 
 Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String &filename) {
+	finishSaves(&filename);
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -135,15 +206,98 @@ Common::InSaveFile *DefaultSaveFileManager::openForLoading(const Common::String
 }
 
 Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String &filename, bool compress) {
+	// A pending background save would overwrite this one later on
+	finishSaves(&filename);
+
+	Common::FSNode fileNode;
+	if (!prepareForSaving(filename, fileNode))
+		return nullptr;
+
+	// Open the file for saving.
+	Common::WriteStream *const sf = fileNode.createWriteStream();
+	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+
+	// Add file to cache now that it exists.
+	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+
+	return result;
+}
+
+Common::OutSaveFile *DefaultSaveFileManager::openForSavingInBackground(const Common::String &filename, bool compress) {
+	Common::FSNode fileNode;
+	if (!prepareForSaving(filename, fileNode))
+		return nullptr;
+
+	PendingSave *save = new PendingSave();
+	save->filename = filename;
+	save->path = fileNode.getPath();
+	save->tempPath = fileNode.getParent().getChild(filename + kPartialSaveSuffix).getPath();
+	save->data = nullptr;
+	save->size = 0;
+	save->written = 0;
+	save->compress = compress;
+	save->stream = nullptr;
+
+	// Add file to cache, loading it waits until it exists.
+	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+
+	return new BackgroundOutSaveFile(new BackgroundSaveStream(this, save));
+}
+
+void DefaultSaveFileManager::processPendingSaves() {
+	if (_pendingSaves.empty())
+		return;
+
+	PendingSave *save = _pendingSaves.front();
+	if (writeSaveChunk(*save)) {
+		_pendingSaves.pop_front();
+		delete save;
+	}
+}
+
+bool DefaultSaveFileManager::hasPendingSaves() {
+	return !_pendingSaves.empty();
+}
+
+bool DefaultSaveFileManager::waitForSaves() {
+	finishSaves();
+
+	Common::StringArray failedSaves = _failedSaves;
+	_failedSaves.clear();
+	const bool savesWritten = _savesWritten;
+	_savesWritten = false;
+
+#if defined(USE_CLOUD) && defined(USE_LIBCURL)
+	if (savesWritten)
+		CloudMan.syncSaves();
+#endif
+
+	if (failedSaves.empty())
+		return true;
+
+	// Savefiles which did not exist before are still in the cache
+	_cachedDirectory.clear();
+
+	Common::String names;
+	for (Common::StringArray::const_iterator i = failedSaves.begin(), end = failedSaves.end(); i != end; ++i) {
+		if (!names.empty())
+			names += ", ";
+		names += *i;
+	}
+	setError(Common::kWritingFailed, "Could not write savefiles: " + names);
+	return false;
+}
+
+bool DefaultSaveFileManager::prepareForSaving(const Common::String &filename, Common::FSNode &fileNode) {
 	// Assure the savefile name cache is up-to-date.
 	const Common::String savePathName = getSavePath();
 	assureCached(savePathName);
 	if (getError().getCode() != Common::kNoError)
-		return nullptr;
+		return false;
 
 	for (Common::StringArray::const_iterator i = _lockedFiles.begin(), end = _lockedFiles.end(); i != end; ++i) {
 		if (filename == *i) {
-			return nullptr; //file is locked, no saving available
+			return false; //file is locked, no saving available
 		}
 	}
 
@@ -154,11 +308,13 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 	saveTimestamps(timestamps);
 #endif
 
+	// The file is about to change, so its description is no longer valid
+	_saveDescriptions.erase(filename);
+
 	// Obtain node.
 	SaveFileCache::const_iterator file = _saveFileCache.find(filename);
-	Common::FSNode fileNode;
 
-	// If the file did not exist before, we add it to the cache.
+	// If the file did not exist before, it is added to the cache by the caller.
 	if (file == _saveFileCache.end()) {
 		const Common::FSNode savePath(savePathName);
 		fileNode = savePath.getChild(filename);
@@ -166,17 +322,97 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 		fileNode = file->_value;
 	}
 
-	// Open the file for saving.
-	Common::WriteStream *const sf = fileNode.createWriteStream();
-	Common::OutSaveFile *const result = new Common::OutSaveFile(compress ? Common::wrapCompressedWriteStream(sf) : sf);
+	return true;
+}
 
-	// Add file to cache now that it exists.
-	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+void DefaultSaveFileManager::queueSave(PendingSave *save) {
+	_pendingSaves.push_back(save);
+}
 
-	return result;
+void DefaultSaveFileManager::finishSaves(const Common::String *filename) {
+	uint count = 0;
+	if (filename) {
+		// Saves are written in order, so all saves queued before the
+		// last one with the given name have to be written as well.
+		uint index = 0;
+		for (Common::List<PendingSave *>::const_iterator i = _pendingSaves.begin(); i != _pendingSaves.end(); ++i) {
+			++index;
+			if ((*i)->filename.equalsIgnoreCase(*filename))
+				count = index;
+		}
+	} else {
+		count = _pendingSaves.size();
+	}
+
+	for (; count > 0; --count) {
+		PendingSave *save = _pendingSaves.front();
+		while (!writeSaveChunk(*save)) {
+		}
+		_pendingSaves.pop_front();
+		delete save;
+	}
+}
+
+bool DefaultSaveFileManager::writeSaveChunk(PendingSave &save) {
+	bool failed = false;
+
+	if (!save.stream) {
+		Common::WriteStream *sf = Common::FSNode(save.tempPath).createWriteStream();
+		save.stream = save.compress ? Common::wrapCompressedWriteStream(sf) : sf;
+		failed = !save.stream;
+	}
+
+	if (!failed) {
+		const uint32 len = MIN<uint32>(save.size - save.written, kBackgroundSaveChunkSize);
+		failed = save.stream->write(save.data + save.written, len) != len;
+		save.written += len;
+	}
+
+	if (!failed && save.written < save.size)
+		return false;
+
+	if (save.stream) {
+		save.stream->finalize();
+		failed = failed || save.stream->err();
+		delete save.stream;
+		save.stream = nullptr;
+	}
+
+	free(save.data);
+	save.data = nullptr;
+
+	// Replace the old savefile only now that the new one is complete.
+	// Renaming onto an existing file fails on some systems. In that case
+	// the old savefile is moved aside, and only removed once the new one
+	// took its place.
+	if (!failed && rename(save.tempPath.c_str(), save.path.c_str()) != 0) {
+		const Common::String replacedPath = save.path + kReplacedSaveSuffix;
+		remove(replacedPath.c_str());
+
+		if (rename(save.path.c_str(), replacedPath.c_str()) != 0) {
+			failed = true;
+		} else if (rename(save.tempPath.c_str(), save.path.c_str()) != 0) {
+			rename(replacedPath.c_str(), save.path.c_str());
+			failed = true;
+		} else {
+			remove(replacedPath.c_str());
+		}
+	}
+
+	if (failed) {
+		remove(save.tempPath.c_str());
+		warning("DefaultSaveFileManager: Could not write savefile '%s'", save.filename.c_str());
+		_failedSaves.push_back(save.filename);
+	} else {
+		_savesWritten = true;
+	}
+
+	return true;
 }
 
 bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
+	finishSaves(&filename);
+
 	// Assure the savefile name cache is up-to-date.
 	assureCached(getSavePath());
 	if (getError().getCode() != Common::kNoError)
@@ -192,6 +428,8 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 	}
 #endif
 
+	_saveDescriptions.erase(filename);
+
 	// Obtain node if exists.
 	SaveFileCache::const_iterator file = _saveFileCache.find(filename);
 	if (file == _saveFileCache.end()) {
@@ -220,6 +458,30 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 	}
 }
 
+bool DefaultSaveFileManager::getSaveDescription(const Common::String &filename, Common::String &description) {
+	// Assure the savefile name cache is up-to-date.
+	assureCached(getSavePath());
+	if (getError().getCode() != Common::kNoError)
+		return false;
+
+	SaveDescriptionCache::const_iterator i = _saveDescriptions.find(filename);
+	if (i == _saveDescriptions.end() || !_saveFileCache.contains(filename))
+		return false;
+
+	description = i->_value;
+	return true;
+}
+
+void DefaultSaveFileManager::setSaveDescription(const Common::String &filename, const Common::String &description) {
+	// Assure the savefile name cache is up-to-date.
+	assureCached(getSavePath());
+	if (getError().getCode() != Common::kNoError)
+		return;
+
+	if (_saveFileCache.contains(filename))
+		_saveDescriptions[filename] = description;
+}
+
 Common::String DefaultSaveFileManager::getSavePath() const {
 
 	Common::String dir;
@@ -258,6 +520,7 @@ void DefaultSaveFileManager::assureCached(const Common::String &savePathName) {
 	}
 
 	_saveFileCache.clear();
+	_saveDescriptions.clear();
 	_cachedDirectory.clear();
 
 	if (getError().getCode() != Common::kNoError) {
@@ -276,7 +539,10 @@ void DefaultSaveFileManager::assureCached(const Common::String &savePathName) {
 
 	// Build the savefile name cache.
 	for (Common::FSList::const_iterator file = children.begin(), end = children.end(); file != end; ++file) {
-		if (_saveFileCache.contains(file->getName())) {
+		if (file->getName().hasSuffix(kPartialSaveSuffix) || file->getName().hasSuffix(kReplacedSaveSuffix)) {
+			// Leftover of an interrupted background save
+			continue;
+		} else if (_saveFileCache.contains(file->getName())) {
 			warning("DefaultSaveFileManager::assureCached: Name clash when building cache, ignoring file '%s'", file->getName().c_str());
 		} else {
 			_saveFileCache[file->getName()] = *file;
@@ -28,6 +28,7 @@
 #include "common/str.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
+#include "common/list.h"
 #include <limits.h>
 
 /**
@@ -37,13 +38,20 @@ class DefaultSaveFileManager : public Common::SaveFileManager {
 public:
 	DefaultSaveFileManager();
 	DefaultSaveFileManager(const Common::String &defaultSavepath);
+	virtual ~DefaultSaveFileManager();
 
 	virtual void updateSavefilesList(Common::StringArray &lockedFiles);
 	virtual Common::StringArray listSavefiles(const Common::String &pattern);
 	virtual Common::InSaveFile *openRawFile(const Common::String &filename);
 	virtual Common::InSaveFile *openForLoading(const Common::String &filename);
 	virtual Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true);
+	virtual Common::OutSaveFile *openForSavingInBackground(const Common::String &filename, bool compress = true);
+	virtual void processPendingSaves();
+	virtual bool hasPendingSaves();
+	virtual bool waitForSaves();
 	virtual bool removeSavefile(const Common::String &filename);
+	virtual bool getSaveDescription(const Common::String &filename, Common::String &description);
+	virtual void setSaveDescription(const Common::String &filename, const Common::String &description);
 
 #ifdef USE_LIBCURL
 
@@ -88,6 +96,15 @@ protected:
 	 */
 	SaveFileCache _saveFileCache;
 
+	typedef Common::HashMap<Common::String, Common::String, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SaveDescriptionCache;
+
+	/**
+	 * Descriptions of save files, as stored by setSaveDescription. Entries
+	 * are removed whenever their file is opened for saving or removed, and
+	 * the whole cache is dropped together with _saveFileCache.
+	 */
+	SaveDescriptionCache _saveDescriptions;
+
 	/**
 	 * List of "locked" files. These cannot be used for saving/loading
 	 * because CloudManager is downloading those.
@@ -95,6 +112,62 @@ protected:
 	Common::StringArray _lockedFiles;
 
 private:
+	friend class BackgroundSaveStream;
+
+	/**
+	 * A savefile which was serialized by the engine and waits to be
+	 * written.
+	 */
+	struct PendingSave {
+		Common::String filename;
+		Common::String path;
+		Common::String tempPath;
+		byte *data;
+		uint32 size;
+		uint32 written;
+		bool compress;
+		Common::WriteStream *stream;
+	};
+
+	enum {
+		/** Amount of data written per processPendingSaves() call */
+		kBackgroundSaveChunkSize = 16 * 1024
+	};
+
+	/**
+	 * Look up the node of a savefile about to be written, and update the
+	 * caches accordingly.
+	 *
+	 * @return false if the savefile can not be written right now.
+	 */
+	bool prepareForSaving(const Common::String &filename, Common::FSNode &fileNode);
+
+	/**
+	 * Queue a serialized savefile for writing.
+	 */
+	void queueSave(PendingSave *save);
+
+	/**
+	 * Write pending savefiles completely. If a filename is given, only the
+	 * savefiles up to the last one with that name are written, otherwise
+	 * all of them.
+	 */
+	void finishSaves(const Common::String *filename = nullptr);
+
+	/**
+	 * Write the next chunk of a pending savefile.
+	 *
+	 * @return true once the savefile is done, successfully or not.
+	 */
+	bool writeSaveChunk(PendingSave &save);
+
+	/**
+	 * Savefiles waiting to be written, in the order they were saved.
+	 */
+	Common::List<PendingSave *> _pendingSaves;
+	Common::StringArray _failedSaves;
+	bool _savesWritten;
+
 	/**
 	 * The currently cached directory.
 	 */
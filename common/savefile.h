@@ -141,6 +141,55 @@ public:
 	 */
 	virtual OutSaveFile *openForSaving(const String &name, bool compress = true) = 0;
 
+	/**
+	 * Open the savefile with the specified name for saving in the
+	 * background.
+	 *
+	 * Everything written to the returned OutSaveFile is kept in memory.
+	 * Once it is finalized or deleted, the data is compressed and written
+	 * to disk a small part at a time, whenever processPendingSaves() is
+	 * called, so the caller does not have to wait for it. Engines using this
+	 * should call processPendingSaves() regularly, e.g. once per frame. An
+	 * existing savefile is only replaced after the new one was written
+	 * completely.
+	 *
+	 * Loading, removing or synchronously saving a savefile which is still
+	 * being written finishes writing it first. Use hasPendingSaves() and
+	 * waitForSaves() to find out whether the data made it to disk.
+	 *
+	 * The default implementation saves synchronously.
+	 *
+	 * @param name      The name of the savefile.
+	 * @param compress  Toggles whether to compress the resulting save file
+	 *                  (default) or not.
+	 * @return Pointer to an OutSaveFile, or NULL if an error occurred.
+	 */
+	virtual OutSaveFile *openForSavingInBackground(const String &name, bool compress = true) { return openForSaving(name, compress); }
+
+	/**
+	 * Write the next part of the savefiles opened with
+	 * openForSavingInBackground().
+	 */
+	virtual void processPendingSaves() {}
+
+	/**
+	 * Check whether savefiles opened with openForSavingInBackground() are
+	 * still being written.
+	 *
+	 * @return true if any savefile is still being written, false otherwise.
+	 */
+	virtual bool hasPendingSaves() { return false; }
+
+	/**
+	 * Wait until all savefiles opened with openForSavingInBackground() are
+	 * written.
+	 *
+	 * @return true if all savefiles written in the background since the
+	 *         last call succeeded, false otherwise. In the latter case the
+	 *         error is set accordingly.
+	 */
+	virtual bool waitForSaves() { return true; }
+
 	/**
 	 * Open the file with the specified name in the given directory for loading.
 	 *
@@ -197,6 +246,26 @@ public:
 	 */
 	virtual StringArray listSavefiles(const String &pattern) = 0;
 
+	/**
+	 * Look up the description an engine stored for a savefile with
+	 * setSaveDescription(). This allows listing savegames without opening
+	 * every savefile. A description is forgotten as soon as its savefile is
+	 * written to or removed.
+	 *
+	 * @param name         Name of the savefile.
+	 * @param description  Set to the stored description, if any.
+	 * @return true if a description was stored, false otherwise.
+	 */
+	virtual bool getSaveDescription(const String &name, String &description) { return false; }
+
+	/**
+	 * Store the description of a savefile for getSaveDescription().
+	 *
+	 * @param name         Name of the savefile.
+	 * @param description  Description read from the savefile.
+	 */
+	virtual void setSaveDescription(const String &name, const String &description) {}
+
 	/**
 	 * Refreshes the save files list (because some new files could've been added)
 	 * and remembers the "locked" files list. These files could not be used
@@ -588,6 +588,9 @@ void BladeRunnerEngine::initChapterAndScene() {
 void BladeRunnerEngine::shutdown() {
 	_mixer->stopAll();
 
+	if (!_system->getSavefileManager()->waitForSaves())
+		warning("%s", _system->getSavefileManager()->popErrorDesc().c_str());
+
 	// BLADE.INI as updated here
 
 	delete _vk;
@@ -834,6 +837,13 @@ void BladeRunnerEngine::gameLoop() {
 void BladeRunnerEngine::gameTick() {
 	handleEvents();
 
+	// Write saves in small parts, and report failed ones once done
+	Common::SaveFileManager *saveFileMan = _system->getSavefileManager();
+	saveFileMan->processPendingSaves();
+	if (!saveFileMan->hasPendingSaves() && !saveFileMan->waitForSaves()) {
+		warning("%s", saveFileMan->popErrorDesc().c_str());
+	}
+
 	if (!_gameIsRunning || !_windowIsActive) {
 		return;
 	}
@@ -42,6 +42,15 @@ SaveStateList SaveFileManager::list(const Common::String &target) {
 
 	SaveStateList saveList;
 	for (Common::StringArray::const_iterator fileName = files.begin(); fileName != files.end(); ++fileName) {
+		int slotNum = atoi(fileName->c_str() + fileName->size() - 3);
+
+		// Avoid opening saves which were listed before
+		Common::String description;
+		if (saveFileMan->getSaveDescription(*fileName, description)) {
+			saveList.push_back(SaveStateDescriptor(slotNum, description));
+			continue;
+		}
+
 		Common::InSaveFile *saveFile = saveFileMan->openForLoading(*fileName);
 		if (saveFile == nullptr || saveFile->err()) {
 			delete saveFile;
@@ -51,8 +60,8 @@ SaveStateList SaveFileManager::list(const Common::String &target) {
 		BladeRunner::SaveFileHeader header;
 		readHeader(*saveFile, header);
 
-		int slotNum = atoi(fileName->c_str() + fileName->size() - 3);
 		saveList.push_back(SaveStateDescriptor(slotNum, header._name));
+		saveFileMan->setSaveDescription(*fileName, header._name);
 
 		delete saveFile;
 	}
@@ -91,7 +100,8 @@ Common::InSaveFile *SaveFileManager::openForLoading(const Common::String &target
 
 Common::OutSaveFile *SaveFileManager::openForSaving(const Common::String &target, int slot) {
 	Common::String filename = Common::String::format("%s.%03d", target.c_str(), slot);
-	return g_system->getSavefileManager()->openForSaving(filename);
+	// Saves are large, compress and write them without stalling the game
+	return g_system->getSavefileManager()->openForSavingInBackground(filename);
 }
 
 void SaveFileManager::remove(const Common::String &target, int slot) {
@@ -61,6 +61,9 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_m13               = 0;
 	_m23               = 0;
 
+	memset(_litColorStamps, 0, sizeof(_litColorStamps));
+	_litColorStamp     = 0;
+
 	_shadowPolygonDefault[ 0] = Vector3( 16.0f,  96.0f, 0.0f);
 	_shadowPolygonDefault[ 1] = Vector3( 16.0f, 160.0f, 0.0f);
 	_shadowPolygonDefault[ 2] = Vector3( 64.0f, 192.0f, 0.0f);
@@ -469,6 +472,7 @@ void SliceRenderer::drawInWorld(int animationId, int animationFrame, Vector3 pos
 		_setEffectColor.b = setEffectColor.b * 31.0f * 65536.0f;
 
 		if (frameY >= 0 && frameY < 480) {
+			invalidateLitColors();
 			drawSlice((int)sliceLine, true, frameLinePtr, zBufferLinePtr, frameY);
 		}
 
@@ -541,6 +545,22 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	}
 }
 
+void SliceRenderer::invalidateLitColors() {
+	if (++_litColorStamp == 0) {
+		memset(_litColorStamps, 0, sizeof(_litColorStamps));
+		_litColorStamp = 1;
+	}
+}
+
+uint16 SliceRenderer::calculateLitColor(Color256 color, Color256 aescColor) const {
+	color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536) + aescColor.r;
+	color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536) + aescColor.g;
+	color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536) + aescColor.b;
+
+	int bladeToScummVmConstant = 256 / 32;
+	return _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+}
+
 void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y) {
 	if (slice < 0 || (uint32)slice >= _frameSliceCount) {
 		return;
@@ -580,13 +600,17 @@ void SliceRenderer::drawSlice(int slice, bool advanced, uint16 *frameLinePtr, ui
 						Color256 aescColor = { 0, 0, 0 };
 						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
 
-						Color256 color = palette.color[p[2]];
-						color.r = ((int)(_setEffectColor.r + _lightsColor.r * color.r) / 65536) + aescColor.r;
-						color.g = ((int)(_setEffectColor.g + _lightsColor.g * color.g) / 65536) + aescColor.g;
-						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536) + aescColor.b;
-
-						int bladeToScummVmConstant = 256 / 32;
-						color555 = _pixelFormat.RGBToColor(CLIP(color.r * bladeToScummVmConstant, 0, 255), CLIP(color.g * bladeToScummVmConstant, 0, 255), CLIP(color.b * bladeToScummVmConstant, 0, 255));
+						if (aescColor.r == 0 && aescColor.g == 0 && aescColor.b == 0) {
+							// Not touched by any screen effect, so the color only
+							// depends on the palette entry
+							if (_litColorStamps[p[2]] != _litColorStamp) {
+								_litColors[p[2]] = calculateLitColor(palette.color[p[2]], aescColor);
+								_litColorStamps[p[2]] = _litColorStamp;
+							}
+							color555 = _litColors[p[2]];
+						} else {
+							color555 = calculateLitColor(palette.color[p[2]], aescColor);
+						}
 					}
 					for (int x = previousVertexX; x != vertexX; ++x) {
 						if (vertexZ < zbufLinePtr[x]) {
@@ -89,6 +89,12 @@ class SliceRenderer {
 	Color _setEffectColor;
 	Color _lightsColor;
 
+	// Lighting is constant along a slice line, so lit palette colors are
+	// cached per line. An entry is valid if its stamp matches the current one.
+	uint16 _litColors[256];
+	uint32 _litColorStamps[256];
+	uint32 _litColorStamp;
+
 	Graphics::PixelFormat _pixelFormat;
 
 public:
@@ -114,6 +120,8 @@ private:
 	Matrix3x2 calculateFacingRotationMatrix();
 	void loadFrame(int animation, int frame);
 
+	void invalidateLitColors();
+	uint16 calculateLitColor(Color256 color, Color256 aescColor) const;
 	void drawSlice(int slice, bool advanced, uint16 *frameLinePtr, uint16 *zbufLinePtr, int y);
 	void drawShadowInWorld(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
 	void drawShadowPolygon(int transparency, Graphics::Surface &surface, uint16 *zbuffer);
@@ -576,6 +576,17 @@ bool VQADecoder::readLNIN(Common::SeekableReadStream *s, uint32 size) {
 	return true;
 }
 
+void VQADecoder::readNextCodebook(int frame) {
+	for (uint i = 0; i != _codebooks.size(); ++i) {
+		if (_codebooks[i].frame > frame) {
+			if (!_codebooks[i].data) {
+				readFrame(_codebooks[i].frame, kVQAReadCodebook);
+			}
+			return;
+		}
+	}
+}
+
 bool VQADecoder::getLoopBeginAndEndFrame(int loop, int *begin, int *end) {
 	assert(begin && end);
 
@@ -859,17 +870,29 @@ void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsig
 		uint16      *__restrict dst = frame + dst_offset;
 
 		unsigned int block_y;
-		for (block_y = 0; block_y != block_height; ++block_y) {
-			unsigned int block_x;
-			for (block_x = 0; block_x != block_width; ++block_x) {
-				uint16 rgb555 = src[0] | (src[1] << 8);
-				src += 2;
-
-				if (!(alpha && (rgb555 & 0x8000)))
-					*dst = rgb555;
-				++dst;
+		if (alpha) {
+			for (block_y = 0; block_y != block_height; ++block_y) {
+				unsigned int block_x;
+				for (block_x = 0; block_x != block_width; ++block_x) {
+					uint16 rgb555 = src[0] | (src[1] << 8);
+					src += 2;
+
+					if (!(rgb555 & 0x8000))
+						*dst = rgb555;
+					++dst;
+				}
+				dst += frame_stride - block_width;
+			}
+		} else {
+			// Opaque blocks are plain row copies
+			for (block_y = 0; block_y != block_height; ++block_y) {
+				unsigned int block_x;
+				for (block_x = 0; block_x != block_width; ++block_x) {
+					dst[block_x] = READ_LE_UINT16(src + 2 * block_x);
+				}
+				src += 2 * block_width;
+				dst += frame_stride;
 			}
-			dst += frame_stride - block_width;
 		}
 
 		++dstBlock;
@@ -63,6 +63,9 @@ public:
 
 	void readFrame(int frame, uint readFlags = kVQAReadAll);
 
+	// Decompress the first codebook used after the given frame, unless already done
+	void readNextCodebook(int frame);
+
 	void                        decodeVideoFrame(Graphics::Surface *surface, int frame, bool forceDraw = false);
 	void                        decodeZBuffer(ZBuffer *zbuffer);
 	Audio::SeekableAudioStream *decodeAudioFrame();
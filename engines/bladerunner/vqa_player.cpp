@@ -107,6 +107,11 @@ int VQAPlayer::update(bool forceDraw, bool advanceFrame, bool useTime, Graphics:
 	} else if (_frameNext > _frameEnd) {
 		result = -3;
 	} else if (useTime && (now < _frameNextTime)) {
+		// Decompress the codebook following the current one while waiting
+		// for the next frame, so the frame switching to it does not have to
+		if (_frame >= 0) {
+			_decoder.readNextCodebook(_frame);
+		}
 		result = -1;
 	} else if (advanceFrame) {
 		_frame = _frameNext;
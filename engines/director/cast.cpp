@@ -28,6 +28,9 @@
 namespace Director {
 
 BitmapCast::BitmapCast(Common::ReadStreamEndian &stream, uint32 castTag, uint16 version) {
+	matteMask = nullptr;
+	matteColor = -1;
+
 	if (version < 4) {
 		flags = stream.readByte();
 		someFlaggyThing = stream.readUint16();
@@ -92,6 +95,13 @@ BitmapCast::BitmapCast(Common::ReadStreamEndian &stream, uint32 castTag, uint16
 	tag = castTag;
 }
 
+BitmapCast::~BitmapCast() {
+	if (matteMask) {
+		matteMask->free();
+		delete matteMask;
+	}
+}
+
 TextCast::TextCast(Common::ReadStreamEndian &stream, uint16 version) {
 	borderSize = kSizeNone;
 	gutterSize = kSizeNone;
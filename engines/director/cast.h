@@ -64,6 +64,7 @@ public:
 class BitmapCast : public Cast {
 public:
 	BitmapCast(Common::ReadStreamEndian &stream, uint32 castTag, uint16 version = 2);
+	~BitmapCast();
 
 	uint16 regX;
 	uint16 regY;
@@ -74,6 +75,11 @@ public:
 	uint16 bitsPerPixel;
 
 	uint32 tag;
+
+	/** Mask of the pixels left transparent by matte ink, built on first use */
+	Graphics::Surface *matteMask;
+	/** Palette index matteMask was built for */
+	int matteColor;
 };
 
 enum ShapeType {
@@ -50,7 +50,7 @@ void DirectorEngine::processEvents() {
 		warning("processEvents: request to access frame %d of %d", sc->getCurrentFrame(), sc->_frames.size() - 1);
 		return;
 	}
-	Frame *currentFrame = sc->_frames[sc->getCurrentFrame()];
+	Frame *currentFrame = sc->getFrame(sc->getCurrentFrame());
 	uint16 spriteId = 0;
 
 	Common::Point pos;
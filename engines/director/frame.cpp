@@ -415,7 +415,8 @@ void Frame::prepareFrame(Score *score) {
 		playSoundChannel();
 	}
 
-	g_system->copyRectToScreen(score->_surface->getPixels(), score->_surface->pitch, 0, 0, score->_surface->getBounds().width(), score->_surface->getBounds().height());
+	// Transitions draw to the screen themselves, so the whole stage is stale
+	score->updateScreen(_transType != 0);
 }
 
 void Frame::playSoundChannel() {
@@ -724,7 +725,7 @@ void Frame::inkBasedBlit(Graphics::ManagedSurface &targetSurface, const Graphics
 		drawBackgndTransSprite(targetSurface, spriteSurface, drawRect);
 		break;
 	case kInkTypeMatte:
-		drawMatteSprite(targetSurface, spriteSurface, drawRect);
+		drawMatteSprite(targetSurface, spriteSurface, spriteId, drawRect);
 		break;
 	case kInkTypeGhost:
 		drawGhostSprite(targetSurface, spriteSurface, drawRect);
@@ -861,14 +862,26 @@ void Frame::renderText(Graphics::ManagedSurface &surface, uint16 spriteId, Commo
 	inkBasedBlit(surface, textWithFeatures, spriteId, Common::Rect(x, y, x + width, y + height));
 }
 
+/**
+ * Returns the area the ink loops draw to: the draw rect, limited to the
+ * size of the sprite and clipped to the target surface.
+ */
+static Common::Rect getInkBlitRect(const Graphics::ManagedSurface &target, const Graphics::Surface &sprite, const Common::Rect &drawRect) {
+	Common::Rect blitRect(drawRect.left, drawRect.top, drawRect.left + MIN<int>(drawRect.width(), sprite.w), drawRect.top + sprite.h);
+	blitRect.clip(target.w, target.h);
+	return blitRect;
+}
+
 void Frame::drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1; // FIXME is it always white (last entry in pallette) ?
 
-	for (int ii = 0; ii < sprite.h; ii++) {
-		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
-		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
+	const Common::Rect blitRect = getInkBlitRect(target, sprite, drawRect);
 
-		for (int j = 0; j < drawRect.width(); j++) {
+	for (int ii = blitRect.top; ii < blitRect.bottom; ii++) {
+		const byte *src = (const byte *)sprite.getBasePtr(blitRect.left - drawRect.left, ii - drawRect.top);
+		byte *dst = (byte *)target.getBasePtr(blitRect.left, ii);
+
+		for (int j = blitRect.left; j < blitRect.right; j++) {
 			if (*src != skipColor)
 				*dst = *src;
 
@@ -878,14 +891,32 @@ void Frame::drawBackgndTransSprite(Graphics::ManagedSurface &target, const Graph
 	}
 }
 
+bool Frame::isSpriteCoveringRect(const Common::Rect &rect, bool &covered) {
+	// Sprites are usually blitted right after their draw rect was added, in
+	// which case getSpriteIDFromPos() is the same for every pixel of the rect
+	if (_drawRects.empty() || !_drawRects.back()->rect.contains(rect))
+		return false;
+
+	covered = _drawRects.back()->spriteId != 0;
+	return true;
+}
+
 void Frame::drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
-	for (int ii = 0; ii < sprite.h; ii++) {
-		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
-		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
+	const Common::Rect blitRect = getInkBlitRect(target, sprite, drawRect);
+
+	bool covered = false;
+	bool uniform = isSpriteCoveringRect(blitRect, covered);
+
+	for (int ii = blitRect.top; ii < blitRect.bottom; ii++) {
+		const byte *src = (const byte *)sprite.getBasePtr(blitRect.left - drawRect.left, ii - drawRect.top);
+		byte *dst = (byte *)target.getBasePtr(blitRect.left, ii);
 
-		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0) && (*src != skipColor))
+		for (int j = blitRect.left; j < blitRect.right; j++) {
+			if (!uniform)
+				covered = getSpriteIDFromPos(Common::Point(j, ii)) != 0;
+
+			if (covered && (*src != skipColor))
 				*dst = (_vm->getPaletteColorCount() - 1) - *src; // Oposite color
 
 			src++;
@@ -896,12 +927,20 @@ void Frame::drawGhostSprite(Graphics::ManagedSurface &target, const Graphics::Su
 
 void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
 	uint8 skipColor = _vm->getPaletteColorCount() - 1;
-	for (int ii = 0; ii < sprite.h; ii++) {
-		const byte *src = (const byte *)sprite.getBasePtr(0, ii);
-		byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + ii);
+	const Common::Rect blitRect = getInkBlitRect(target, sprite, drawRect);
+
+	bool covered = false;
+	bool uniform = isSpriteCoveringRect(blitRect, covered);
+
+	for (int ii = blitRect.top; ii < blitRect.bottom; ii++) {
+		const byte *src = (const byte *)sprite.getBasePtr(blitRect.left - drawRect.left, ii - drawRect.top);
+		byte *dst = (byte *)target.getBasePtr(blitRect.left, ii);
 
-		for (int j = 0; j < drawRect.width(); j++) {
-			if ((getSpriteIDFromPos(Common::Point(drawRect.left + j, drawRect.top + ii)) != 0)) {
+		for (int j = blitRect.left; j < blitRect.right; j++) {
+			if (!uniform)
+				covered = getSpriteIDFromPos(Common::Point(j, ii)) != 0;
+
+			if (covered) {
 				if (*src != skipColor) {
 					*dst = (*dst == *src ? (*src == 0 ? 0xff : 0) : *src);
 				}
@@ -914,19 +953,43 @@ void Frame::drawReverseSprite(Graphics::ManagedSurface &target, const Graphics::
 	}
 }
 
-void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, Common::Rect &drawRect) {
-	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
+Graphics::Surface *Frame::createMatteMask(const Graphics::Surface &sprite, byte whiteColor) {
+	// White pixels which can be reached from the border are transparent
 	Graphics::Surface tmp;
 	tmp.copyFrom(sprite);
 
+	Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
+
+	for (int yy = 0; yy < tmp.h; yy++) {
+		ff.addSeed(0, yy);
+		ff.addSeed(tmp.w - 1, yy);
+	}
+
+	for (int xx = 0; xx < tmp.w; xx++) {
+		ff.addSeed(xx, 0);
+		ff.addSeed(xx, tmp.h - 1);
+	}
+	ff.fillMask();
+
+	Graphics::Surface *mask = new Graphics::Surface();
+	mask->copyFrom(*ff.getMask());
+
+	tmp.free();
+
+	return mask;
+}
+
+void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Surface &sprite, uint16 spriteId, Common::Rect &drawRect) {
+	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels are transparent
+
 	// Searching white color in the corners
 	int whiteColor = -1;
 
 	for (int corner = 0; corner < 4; corner++) {
-		int x = (corner & 0x1) ? tmp.w - 1 : 0;
-		int y = (corner & 0x2) ? tmp.h - 1 : 0;
+		int x = (corner & 0x1) ? sprite.w - 1 : 0;
+		int y = (corner & 0x2) ? sprite.h - 1 : 0;
 
-		byte color = *(byte *)tmp.getBasePtr(x, y);
+		byte color = *(const byte *)sprite.getBasePtr(x, y);
 
 		if (_vm->getPalette()[color * 3 + 0] == 0xff &&
 			_vm->getPalette()[color * 3 + 1] == 0xff &&
@@ -936,42 +999,56 @@ void Frame::drawMatteSprite(Graphics::ManagedSurface &target, const Graphics::Su
 		}
 	}
 
+	const Common::Rect blitRect = getInkBlitRect(target, sprite, drawRect);
+
 	if (whiteColor == -1) {
 		debugC(1, kDebugImages, "No white color for Matte image");
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+		for (int yy = blitRect.top; yy < blitRect.bottom; yy++) {
+			const byte *src = (const byte *)sprite.getBasePtr(blitRect.left - drawRect.left, yy - drawRect.top);
+			byte *dst = (byte *)target.getBasePtr(blitRect.left, yy);
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++)
+			for (int xx = blitRect.left; xx < blitRect.right; xx++, src++, dst++)
 				*dst = *src;
 		}
 	} else {
-		Graphics::FloodFill ff(&tmp, whiteColor, 0, true);
+		// Bitmap casts keep their mask, text and shapes are rendered anew every frame
+		BitmapCast *bitmapCast = _sprites[spriteId]->_bitmapCast;
+		Graphics::Surface *mask;
+		bool ownMask = false;
+
+		if (bitmapCast && bitmapCast->surface == &sprite) {
+			if (!bitmapCast->matteMask || bitmapCast->matteColor != whiteColor) {
+				if (bitmapCast->matteMask) {
+					bitmapCast->matteMask->free();
+					delete bitmapCast->matteMask;
+				}
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			ff.addSeed(0, yy);
-			ff.addSeed(tmp.w - 1, yy);
-		}
+				bitmapCast->matteMask = createMatteMask(sprite, whiteColor);
+				bitmapCast->matteColor = whiteColor;
+			}
 
-		for (int xx = 0; xx < tmp.w; xx++) {
-			ff.addSeed(xx, 0);
-			ff.addSeed(xx, tmp.h - 1);
+			mask = bitmapCast->matteMask;
+		} else {
+			mask = createMatteMask(sprite, whiteColor);
+			ownMask = true;
 		}
-		ff.fillMask();
 
-		for (int yy = 0; yy < tmp.h; yy++) {
-			const byte *src = (const byte *)tmp.getBasePtr(0, yy);
-			const byte *mask = (const byte *)ff.getMask()->getBasePtr(0, yy);
-			byte *dst = (byte *)target.getBasePtr(drawRect.left, drawRect.top + yy);
+		for (int yy = blitRect.top; yy < blitRect.bottom; yy++) {
+			const byte *src = (const byte *)sprite.getBasePtr(blitRect.left - drawRect.left, yy - drawRect.top);
+			const byte *msk = (const byte *)mask->getBasePtr(blitRect.left - drawRect.left, yy - drawRect.top);
+			byte *dst = (byte *)target.getBasePtr(blitRect.left, yy);
 
-			for (int xx = 0; xx < drawRect.width(); xx++, src++, dst++, mask++)
-				if (*mask == 0)
+			for (int xx = blitRect.left; xx < blitRect.right; xx++, src++, dst++, msk++)
+				if (*msk == 0)
 					*dst = *src;
 		}
-	}
 
-	tmp.free();
+		if (ownMask) {
+			mask->free();
+			delete mask;
+		}
+	}
 }
 
 uint16 Frame::getSpriteIDFromPos(Common::Point pos) {
@@ -53,18 +53,24 @@
 namespace Director {
 
 void Lingo::execute(uint pc) {
-	for(_pc = pc; (*_currentScript)[_pc] != STOP && !_returning;) {
-		Common::String instr = decodeInstruction(_pc);
+	// Decoding an instruction for the trace costs far more than executing it,
+	// so only do so when the trace is enabled
+	const bool traceInstructions = debugChannelSet(1, kDebugLingoExec);
+	const bool traceStack = debugChannelSet(5, kDebugLingoExec);
 
-		if (debugChannelSet(5, kDebugLingoExec))
+	for(_pc = pc; (*_currentScript)[_pc] != STOP && !_returning;) {
+		if (traceStack)
 			printStack("Stack before: ");
 
-		debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, instr.c_str());
+		if (traceInstructions) {
+			Common::String instr = decodeInstruction(_pc);
+			debugC(1, kDebugLingoExec, "[%3d]: %s", _pc, instr.c_str());
+		}
 
 		_pc++;
 		(*((*_currentScript)[_pc - 1]))();
 
-		if (debugChannelSet(5, kDebugLingoExec))
+		if (traceStack)
 			printStack("Stack after: ");
 	}
 }
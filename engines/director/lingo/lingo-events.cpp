@@ -151,7 +151,7 @@ void Lingo::processInputEvent(LEvent event) {
 	 * [D4 docs] */
 
 	Score *score = _vm->getCurrentScore();
-	Frame *currentFrame = score->_frames[score->getCurrentFrame()];
+	Frame *currentFrame = score->getFrame(score->getCurrentFrame());
 	assert(currentFrame != nullptr);
 	uint16 spriteId = score->_currentMouseDownSpriteId;
 
@@ -166,7 +166,7 @@ void Lingo::processInputEvent(LEvent event) {
 				g_lingo->processEvent(event, kSpriteScript, currentFrame->_sprites[spriteId]->_scriptId);
 			}
 			g_lingo->processEvent(event, kCastScript, currentFrame->_sprites[spriteId]->_castId);
-			g_lingo->processEvent(event, kFrameScript, score->_frames[score->getCurrentFrame()]->_actionId);
+			g_lingo->processEvent(event, kFrameScript, score->getFrame(score->getCurrentFrame())->_actionId);
 			// TODO: Is the kFrameScript call above correct?
 		} else if (event == kEventMouseUp) {
 			// Frame script overrides sprite script
@@ -220,8 +220,8 @@ void Lingo::processFrameEvent(LEvent event) {
 		if (event == kEventPrepareFrame || event == kEventIdle) {
 			entity = score->getCurrentFrame();
 		} else {
-			assert(score->_frames[score->getCurrentFrame()] != nullptr);
-			entity = score->_frames[score->getCurrentFrame()]->_actionId;
+			assert(score->getFrame(score->getCurrentFrame()) != nullptr);
+			entity = score->getFrame(score->getCurrentFrame())->_actionId;
 		}
 		processEvent(event,
 		             kFrameScript,
@@ -242,7 +242,7 @@ void Lingo::processGenericEvent(LEvent event) {
 
 void Lingo::processSpriteEvent(LEvent event) {
 	Score *score = _vm->getCurrentScore();
-	Frame *currentFrame = score->_frames[score->getCurrentFrame()];
+	Frame *currentFrame = score->getFrame(score->getCurrentFrame());
 	if (event == kEventBeginSprite) {
 		// TODO: Check if this is also possibly a kSpriteScript?
 		for (uint16 i = 0; i < CHANNEL_COUNT; i++)
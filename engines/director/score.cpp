@@ -67,6 +67,8 @@ Score::Score(DirectorEngine *vm) {
 	_lingo = _vm->getLingo();
 	_soundManager = _vm->getSoundManager();
 	_currentMouseDownSpriteId = 0;
+	_frameDataIsBE = false;
+	_spriteCastsSet = false;
 
 	// FIXME: TODO: Check whether the original truely does it
 	if (_vm->getVersion() <= 3) {
@@ -287,6 +289,8 @@ Score::~Score() {
 	if (_trailSurface)
 		_trailSurface->free();
 
+	_screenCopy.free();
+
 	delete _surface;
 	delete _trailSurface;
 
@@ -371,11 +375,21 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 		warning("STUB: Score::loadFrames. unk1: %x unk2: %x unk3: %x unk4: %x unk5: %x unk6: %x", unk1, unk2, unk3, unk4, unk5, unk6);
 	}
 
-	uint16 channelSize;
-	uint16 channelOffset;
+	uint32 startTime = g_system->getMillis();
 
 	Frame *initial = new Frame(_vm);
 	_frames.push_back(initial);
+	_frameOffsets.push_back(0);
+
+	// Frames only store the channels that changed since the previous frame,
+	// so decoding a frame needs the state left by all the frames before it.
+	// Rather than decoding every frame up front, keep the raw frame data and
+	// a snapshot of the channel state every kKeyFrameInterval frames, and
+	// decode frames the first time they are needed.
+	_frameData.resize(stream.size() - stream.pos());
+	if (!_frameData.empty())
+		stream.read(&_frameData[0], _frameData.size());
+	_frameDataIsBE = stream.isBE();
 
 	// This is a representation of the channelData. It gets overridden
 	// partically by channels, hence we keep it and read the score from left to right
@@ -383,47 +397,93 @@ void Score::loadFrames(Common::SeekableSubReadStreamEndian &stream) {
 	// TODO Merge it with shared cast
 	byte channelData[kChannelDataSize];
 	memset(channelData, 0, kChannelDataSize);
+	_keyFrames.resize(kChannelDataSize);
+	memset(&_keyFrames[0], 0, kChannelDataSize);
+
+	Common::MemoryReadStreamEndian frameStream(_frameData.empty() ? nullptr : &_frameData[0], _frameData.size(), _frameDataIsBE);
 
-	while (size != 0 && !stream.eos()) {
-		uint16 frameSize = stream.readUint16();
+	while (size != 0 && !frameStream.eos()) {
+		uint32 offset = frameStream.pos();
+		uint16 frameSize = frameStream.readUint16();
 		debugC(kDebugLoading, 8, "++++ score frame %d (frameSize %d) size %d", _frames.size(), frameSize, size);
 
 		if (frameSize > 0) {
-			Frame *frame = new Frame(_vm);
 			size -= frameSize;
-			frameSize -= 2;
 
-			while (frameSize != 0) {
+			frameStream.seek(offset);
+			readFrameChannels(frameStream, channelData);
 
-				if (_vm->getVersion() < 4) {
-					channelSize = stream.readByte() * 2;
-					channelOffset = stream.readByte() * 2;
-					frameSize -= channelSize + 2;
-				} else {
-					channelSize = stream.readUint16();
-					channelOffset = stream.readUint16();
-					frameSize -= channelSize + 4;
-				}
+			_frames.push_back(nullptr);
+			_frameOffsets.push_back(offset);
 
-				assert(channelOffset + channelSize < kChannelDataSize);
-				stream.read(&channelData[channelOffset], channelSize);
+			if ((_frames.size() - 1) % kKeyFrameInterval == 0) {
+				uint keyFrameOffset = _keyFrames.size();
+				_keyFrames.resize(keyFrameOffset + kChannelDataSize);
+				memcpy(&_keyFrames[keyFrameOffset], channelData, kChannelDataSize);
 			}
+		} else {
+			warning("zero sized frame!? exiting loop until we know what to do with the tags that follow.");
+			size = 0;
+		}
+	}
 
-			Common::MemoryReadStreamEndian *str = new Common::MemoryReadStreamEndian(channelData, ARRAYSIZE(channelData), stream.isBE());
-			// str->hexdump(str->size(), 32);
-			frame->readChannels(str);
-			delete str;
+	debugC(1, kDebugLoading, "Indexed %d frames in %d ms, keeping %d bytes of frame data", _frames.size() - 1,
+		g_system->getMillis() - startTime, _frameData.size() + _keyFrames.size());
+}
 
-			debugC(3, kDebugLoading, "Frame %d actionId: %d", _frames.size(), frame->_actionId);
+void Score::readFrameChannels(Common::ReadStreamEndian &stream, byte *channelData) {
+	uint16 channelSize;
+	uint16 channelOffset;
+
+	uint16 frameSize = stream.readUint16();
+	frameSize -= 2;
 
-			_frames.push_back(frame);
+	while (frameSize != 0) {
+		if (_vm->getVersion() < 4) {
+			channelSize = stream.readByte() * 2;
+			channelOffset = stream.readByte() * 2;
+			frameSize -= channelSize + 2;
 		} else {
-			warning("zero sized frame!? exiting loop until we know what to do with the tags that follow.");
-			size = 0;
+			channelSize = stream.readUint16();
+			channelOffset = stream.readUint16();
+			frameSize -= channelSize + 4;
 		}
+
+		assert(channelOffset + channelSize < kChannelDataSize);
+		stream.read(&channelData[channelOffset], channelSize);
 	}
 }
 
+Frame *Score::getFrame(uint16 frameId) {
+	if (_frames[frameId])
+		return _frames[frameId];
+
+	// Rebuild the channel state from the closest snapshot before the frame
+	byte channelData[kChannelDataSize];
+	uint16 keyFrame = frameId / kKeyFrameInterval;
+	memcpy(channelData, &_keyFrames[keyFrame * kChannelDataSize], kChannelDataSize);
+
+	Common::MemoryReadStreamEndian frameStream(&_frameData[0], _frameData.size(), _frameDataIsBE);
+	for (uint16 i = keyFrame * kKeyFrameInterval + 1; i <= frameId; i++) {
+		frameStream.seek(_frameOffsets[i]);
+		readFrameChannels(frameStream, channelData);
+	}
+
+	Frame *frame = new Frame(_vm);
+	Common::MemoryReadStreamEndian *str = new Common::MemoryReadStreamEndian(channelData, ARRAYSIZE(channelData), _frameDataIsBE);
+	// str->hexdump(str->size(), 32);
+	frame->readChannels(str);
+	delete str;
+
+	debugC(3, kDebugLoading, "Frame %d actionId: %d", frameId, frame->_actionId);
+
+	if (_spriteCastsSet)
+		setSpriteCasts(frame);
+
+	_frames[frameId] = frame;
+	return frame;
+}
+
 void Score::loadConfig(Common::SeekableSubReadStreamEndian &stream) {
 	debugC(1, kDebugLoading, "****** Loading Config");
 
@@ -489,43 +549,51 @@ void Score::loadCastDataVWCR(Common::SeekableSubReadStreamEndian &stream) {
 }
 
 void Score::setSpriteCasts() {
-	// Set cast pointers to sprites
+	// Set cast pointers to sprites. Frames that have not been decoded yet
+	// get them when they are.
+	_spriteCastsSet = true;
+
 	for (uint16 i = 0; i < _frames.size(); i++) {
-		for (uint16 j = 0; j < _frames[i]->_sprites.size(); j++) {
-			uint16 castId = _frames[i]->_sprites[j]->_castId;
+		if (_frames[i])
+			setSpriteCasts(_frames[i]);
+	}
+}
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedBitmaps->contains(castId)) {
-				_frames[i]->_sprites[j]->_bitmapCast = _vm->getSharedScore()->_loadedBitmaps->getVal(castId);
-			} else if (_loadedBitmaps->contains(castId)) {
-				_frames[i]->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
-			}
+void Score::setSpriteCasts(Frame *frame) {
+	for (uint16 j = 0; j < frame->_sprites.size(); j++) {
+		uint16 castId = frame->_sprites[j]->_castId;
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedButtons->contains(castId)) {
-				_frames[i]->_sprites[j]->_buttonCast = _vm->getSharedScore()->_loadedButtons->getVal(castId);
-				if (_frames[i]->_sprites[j]->_buttonCast->children.size() == 1) {
-					_frames[i]->_sprites[j]->_textCast =
-						_vm->getSharedScore()->_loadedText->getVal(_frames[i]->_sprites[j]->_buttonCast->children[0].index);
-				} else if (_frames[i]->_sprites[j]->_buttonCast->children.size() > 0) {
-					warning("Cast %d has too many children!", j);
-				}
-			} else if (_loadedButtons->contains(castId)) {
-				_frames[i]->_sprites[j]->_buttonCast = _loadedButtons->getVal(castId);
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedBitmaps->contains(castId)) {
+			frame->_sprites[j]->_bitmapCast = _vm->getSharedScore()->_loadedBitmaps->getVal(castId);
+		} else if (_loadedBitmaps->contains(castId)) {
+			frame->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
+		}
+
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedButtons->contains(castId)) {
+			frame->_sprites[j]->_buttonCast = _vm->getSharedScore()->_loadedButtons->getVal(castId);
+			if (frame->_sprites[j]->_buttonCast->children.size() == 1) {
+				frame->_sprites[j]->_textCast =
+					_vm->getSharedScore()->_loadedText->getVal(frame->_sprites[j]->_buttonCast->children[0].index);
+			} else if (frame->_sprites[j]->_buttonCast->children.size() > 0) {
+				warning("Cast %d has too many children!", j);
 			}
+		} else if (_loadedButtons->contains(castId)) {
+			frame->_sprites[j]->_buttonCast = _loadedButtons->getVal(castId);
+		}
 
-			//if (_loadedScripts->contains(castId))
-			//	_frames[i]->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
+		//if (_loadedScripts->contains(castId))
+		//	frame->_sprites[j]->_bitmapCast = _loadedBitmaps->getVal(castId);
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedText->contains(castId)) {
-				_frames[i]->_sprites[j]->_textCast = _vm->getSharedScore()->_loadedText->getVal(castId);
-			} else if (_loadedText->contains(castId)) {
-				_frames[i]->_sprites[j]->_textCast = _loadedText->getVal(castId);
-			}
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedText->contains(castId)) {
+			frame->_sprites[j]->_textCast = _vm->getSharedScore()->_loadedText->getVal(castId);
+		} else if (_loadedText->contains(castId)) {
+			frame->_sprites[j]->_textCast = _loadedText->getVal(castId);
+		}
 
-			if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedShapes->contains(castId)) {
-				_frames[i]->_sprites[j]->_shapeCast = _vm->getSharedScore()->_loadedShapes->getVal(castId);
-			} else if (_loadedShapes->contains(castId)) {
-				_frames[i]->_sprites[j]->_shapeCast = _loadedShapes->getVal(castId);
-			}
+		if (_vm->getSharedScore() != nullptr && _vm->getSharedScore()->_loadedShapes->contains(castId)) {
+			frame->_sprites[j]->_shapeCast = _vm->getSharedScore()->_loadedShapes->getVal(castId);
+		} else if (_loadedShapes->contains(castId)) {
+			frame->_sprites[j]->_shapeCast = _loadedShapes->getVal(castId);
 		}
 	}
 }
@@ -1184,7 +1252,7 @@ void Score::startLoop() {
 	_stopPlay = false;
 	_nextFrameTime = 0;
 
-	_frames[_currentFrame]->prepareFrame(this);
+	getFrame(_currentFrame)->prepareFrame(this);
 
 	while (!_stopPlay && _currentFrame < _frames.size()) {
 		debugC(1, kDebugImages, "******************************  Current frame: %d", _currentFrame + 1);
@@ -1195,6 +1263,61 @@ void Score::startLoop() {
 	}
 }
 
+void Score::updateScreen(bool fullRefresh) {
+	const Graphics::Surface &surface = *_surface;
+
+	if (fullRefresh || _screenCopy.w != surface.w || _screenCopy.h != surface.h) {
+		_screenCopy.free();
+		_screenCopy.copyFrom(surface);
+		g_system->copyRectToScreen(surface.getPixels(), surface.pitch, 0, 0, surface.w, surface.h);
+		return;
+	}
+
+	// Most frames only move a few sprites, so compare the stage with what is
+	// on the screen and only send the rows that changed. Changed rows which
+	// are close together are sent as one rectangle.
+	const int bpp = surface.format.bytesPerPixel;
+	const int rowSize = surface.w * bpp;
+	int top = -1, bottom = 0, left = rowSize, right = 0;
+	int cleanRows = 0;
+
+	for (int y = 0; y <= surface.h; y++) {
+		if (y < surface.h) {
+			const byte *src = (const byte *)surface.getBasePtr(0, y);
+			byte *dst = (byte *)_screenCopy.getBasePtr(0, y);
+
+			if (memcmp(src, dst, rowSize)) {
+				int x1 = 0;
+				while (src[x1] == dst[x1])
+					x1++;
+				int x2 = rowSize;
+				while (src[x2 - 1] == dst[x2 - 1])
+					x2--;
+
+				memcpy(dst + x1, src + x1, x2 - x1);
+
+				if (top == -1)
+					top = y;
+				bottom = y + 1;
+				left = MIN(left, x1);
+				right = MAX(right, x2);
+				cleanRows = 0;
+				continue;
+			}
+		}
+
+		if (top != -1 && (++cleanRows >= kScreenMergeDistance || y == surface.h)) {
+			left = left / bpp;
+			right = (right + bpp - 1) / bpp;
+			g_system->copyRectToScreen(_screenCopy.getBasePtr(left, top), _screenCopy.pitch, left, top, right - left, bottom - top);
+
+			top = -1;
+			left = rowSize;
+			right = 0;
+		}
+	}
+}
+
 void Score::update() {
 	if (g_system->getMillis() < _nextFrameTime)
 		return;
@@ -1202,7 +1325,7 @@ void Score::update() {
 	_surface->clear();
 	_surface->copyFrom(*_trailSurface);
 
-	_lingo->executeImmediateScripts(_frames[_currentFrame]);
+	_lingo->executeImmediateScripts(getFrame(_currentFrame));
 
 	// Enter and exit from previous frame (Director 4)
 	_lingo->processEvent(kEventEnterFrame);
@@ -1233,10 +1356,11 @@ void Score::update() {
 	if (_currentFrame >= _frames.size())
 		return;
 
-	_frames[_currentFrame]->prepareFrame(this);
+	Frame *frame = getFrame(_currentFrame);
+	frame->prepareFrame(this);
 	// Stage is drawn between the prepareFrame and enterFrame events (Lingo in a Nutshell)
 
-	byte tempo = _frames[_currentFrame]->_tempo;
+	byte tempo = frame->_tempo;
 
 	if (tempo) {
 		if (tempo > 161) {
@@ -1273,12 +1397,12 @@ void Score::update() {
 }
 
 Sprite *Score::getSpriteById(uint16 id) {
-	if (_currentFrame >= _frames.size() || id >= _frames[_currentFrame]->_sprites.size()) {
+	if (_currentFrame >= _frames.size() || id >= getFrame(_currentFrame)->_sprites.size()) {
 		warning("Score::getSpriteById(%d): out of bounds. frame: %d", id, _currentFrame);
 		return nullptr;
 	}
-	if (_frames[_currentFrame]->_sprites[id]) {
-		return _frames[_currentFrame]->_sprites[id];
+	if (getFrame(_currentFrame)->_sprites[id]) {
+		return getFrame(_currentFrame)->_sprites[id];
 	} else {
 		warning("Sprite on frame %d width id %d not found", _currentFrame, id);
 		return nullptr;
@@ -81,6 +81,8 @@ public:
 	uint16 getCurrentFrame() { return _currentFrame; }
 	Common::String getMacName() const { return _macName; }
 	Sprite *getSpriteById(uint16 id);
+	Frame *getFrame(uint16 frameId);
+	void updateScreen(bool fullRefresh);
 	void setSpriteCasts();
 	void loadSpriteImages(bool isSharedCast);
 	void copyCastStxts();
@@ -99,6 +101,8 @@ private:
 	void readVersion(uint32 rid);
 	void loadPalette(Common::SeekableSubReadStreamEndian &stream);
 	void loadFrames(Common::SeekableSubReadStreamEndian &stream);
+	void readFrameChannels(Common::ReadStreamEndian &stream, byte *channelData);
+	void setSpriteCasts(Frame *frame);
 	void loadLabels(Common::SeekableSubReadStreamEndian &stream);
 	void loadActions(Common::SeekableSubReadStreamEndian &stream);
 	void loadScriptText(Common::SeekableSubReadStreamEndian &stream);
@@ -111,6 +115,7 @@ private:
 	bool processImmediateFrameScript(Common::String s, int id);
 
 public:
+	/** Decoded frames, frames which have not been accessed yet are nullptr. Use getFrame(). */
 	Common::Array<Frame *> _frames;
 	Common::HashMap<int, CastType> _castTypes;
 	Common::HashMap<uint16, CastInfo *> _castsInfo;
@@ -156,6 +161,22 @@ private:
 	Lingo *_lingo;
 	DirectorSound *_soundManager;
 	DirectorEngine *_vm;
+
+	enum {
+		kKeyFrameInterval = 64,
+		kScreenMergeDistance = 8
+	};
+
+	/** Copy of the stage as it was last sent to the screen */
+	Graphics::Surface _screenCopy;
+
+	/** Raw score frame data, decoded by getFrame() */
+	Common::Array<byte> _frameData;
+	Common::Array<uint32> _frameOffsets;
+	/** Channel state after every kKeyFrameInterval frames */
+	Common::Array<byte> _keyFrames;
+	bool _frameDataIsBE;
+	bool _spriteCastsSet;
 };
 
 } // End of namespace Director
@@ -243,6 +243,13 @@ void Processor::load_all_operands(zbyte specifier) {
 }
 
 void Processor::interpret() {
+	// Checking for a quit request goes through the event manager, which costs
+	// more than decoding and executing most instructions. Events are only
+	// polled by opcodes doing I/O, so checking every so many instructions is
+	// just as responsive.
+	const uint quitCheckMask = 0xff;
+	uint instructionCount = 0;
+
 	do {
 		zbyte opcode;
 		CODE_BYTE(opcode);
@@ -287,7 +294,7 @@ void Processor::interpret() {
 		if (end_of_sound_flag)
 			end_of_sound();
 #endif
-	} while (!shouldQuit() && !_finished);
+	} while (!_finished && ((++instructionCount & quitCheckMask) != 0 || !shouldQuit()));
 
 	_finished--;
 }
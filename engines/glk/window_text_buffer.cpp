@@ -124,14 +124,24 @@ void TextBufferWindow::reflow() {
 		return;
 
 	_lines[0]._len = _numChars;
+	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
+
+	// Size the temp buffers to the text actually held, rather than to a full
+	// scrollback of full lines. Most windows hold far less, and the
+	// attributes are constructed one by one.
+	int numChars = 0, numPics = 0;
+	for (k = s; k >= 0; k--) {
+		numChars += _lines[k]._len + (_lines[k]._newLine ? 1 : 0);
+		numPics += (_lines[k]._lPic ? 1 : 0) + (_lines[k]._rPic ? 1 : 0);
+	}
 
 	// allocate temp buffers
-	Attributes *attrbuf = new Attributes[SCROLLBACK * TBLINELEN];
-	uint32 *charbuf = new uint32[SCROLLBACK * TBLINELEN];
-	int *alignbuf = new int[SCROLLBACK];
-	Picture **pictbuf = new Picture *[SCROLLBACK];
-	uint *hyperbuf = new uint[SCROLLBACK];
-	int *offsetbuf = new int[SCROLLBACK];
+	Attributes *attrbuf = new Attributes[numChars + 1];
+	uint32 *charbuf = new uint32[numChars + 1];
+	int *alignbuf = new int[numPics + 1];
+	Picture **pictbuf = new Picture *[numPics + 1];
+	uint *hyperbuf = new uint[numPics + 1];
+	int *offsetbuf = new int[numPics + 1];
 
 	if (!attrbuf || !charbuf || !alignbuf || !pictbuf || !hyperbuf || !offsetbuf) {
 		delete[] attrbuf;
@@ -150,7 +160,6 @@ void TextBufferWindow::reflow() {
 
 	x = 0;
 	p = 0;
-	s = _scrollMax < SCROLLBACK ? _scrollMax : SCROLLBACK - 1;
 
 	for (k = s; k >= 0; k--) {
 		if (k == 0 && _lineRequest)
@@ -22,14 +22,32 @@
 
 #include "sword25/console.h"
 #include "sword25/sword25.h"
+#include "sword25/kernel/kernel.h"
+#include "sword25/kernel/resmanager.h"
 
 namespace Sword25 {
 
 Sword25Console::Sword25Console(Sword25Engine *vm) : GUI::Debugger(), _vm(vm) {
 	assert(_vm);
+
+	registerCmd("resources", WRAP_METHOD(Sword25Console, Cmd_Resources));
 }
 
 Sword25Console::~Sword25Console() {
 }
 
+bool Sword25Console::Cmd_Resources(int argc, const char **argv) {
+	ResourceManager *resourceManager = Kernel::getInstance()->getResourceManager();
+	if (!resourceManager) {
+		debugPrintf("Resource manager not available\n");
+		return true;
+	}
+
+	ResourceManager::Stats stats = resourceManager->getStats();
+	debugPrintf("Cached resources: %d, %d KB\n", stats.numResources, stats.usedMemory / 1024);
+	debugPrintf("Loads: %d, total load time: %d ms\n", stats.loads, stats.loadTime);
+	debugPrintf("Evictions: %d, forced: %d\n", stats.evictions, stats.forcedEvictions);
+	return true;
+}
+
 } // End of namespace Sword25
@@ -35,6 +35,8 @@ public:
 	virtual ~Sword25Console(void);
 
 private:
+	bool Cmd_Resources(int argc, const char **argv);
+
 	Sword25Engine *_vm;
 };
 
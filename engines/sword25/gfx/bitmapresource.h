@@ -51,6 +51,11 @@ public:
 		return (_pImage != 0);
 	}
 
+	virtual uint getSize() const {
+		// Images are kept as decoded 32-bit pixels
+		return _pImage ? _pImage->getWidth() * _pImage->getHeight() * 4 : 0;
+	}
+
 	/**
 	    @brief Gibt die Breite des Bitmaps zurck.
 	*/
@@ -226,6 +226,8 @@ private:
 	Common::Rect                         _boundingBox;
 
 	byte *_pixelData;
+	int _renderedWidth;   ///< Size _pixelData was last rendered at
+	int _renderedHeight;
 
 	Common::String _fname;
 	uint _bgColor;
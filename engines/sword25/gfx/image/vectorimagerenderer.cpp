@@ -59,29 +59,35 @@ void art_rgb_fill_run1(byte *buf, byte r, byte g, byte b, int n) {
 }
 
 void art_rgb_run_alpha1(byte *buf, byte r, byte g, byte b, int alpha, int n) {
-	int i;
-	int v;
-
-	for (i = 0; i < n; i++) {
-#if defined(SCUMM_LITTLE_ENDIAN)
-		v = *buf;
-		*buf++ = MIN(v + alpha, 0xff);
-		v = *buf;
-		*buf++ = v + (((b - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((g - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((r - v) * alpha + 0x80) >> 8);
-#else
-		v = *buf;
-		*buf++ = v + (((r - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((g - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = v + (((b - v) * alpha + 0x80) >> 8);
-		v = *buf;
-		*buf++ = MIN(v + alpha, 0xff);
-#endif
+	// Pixels are RGBA in native byte order, so blend whole words instead of
+	// loading and storing every channel separately.
+	uint32 *pixel = (uint32 *)buf;
+	uint32 last = 0, lastResult = 0;
+	bool haveLast = false;
+
+	for (int i = 0; i < n; i++) {
+		const uint32 v = pixel[i];
+
+		// Runs mostly cover pixels of the same color
+		if (haveLast && v == last) {
+			pixel[i] = lastResult;
+			continue;
+		}
+
+		const int va = v & 0xff;
+		const int vb = (v >> 8) & 0xff;
+		const int vg = (v >> 16) & 0xff;
+		const int vr = v >> 24;
+
+		const uint32 na = MIN(va + alpha, 0xff);
+		const uint32 nb = (vb + (((b - vb) * alpha + 0x80) >> 8)) & 0xff;
+		const uint32 ng = (vg + (((g - vg) * alpha + 0x80) >> 8)) & 0xff;
+		const uint32 nr = (vr + (((r - vr) * alpha + 0x80) >> 8)) & 0xff;
+
+		last = v;
+		lastResult = (nr << 24) | (ng << 16) | (nb << 8) | na;
+		haveLast = true;
+		pixel[i] = lastResult;
 	}
 }
 
@@ -47,14 +47,17 @@ namespace Sword25 {
 
 void RenderObjectQueue::add(RenderObject *renderObject) {
 	push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion()));
+	_versions[renderObject] = renderObject->getVersion();
 }
 
-bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) {
-	for (RenderObjectQueue::iterator it = begin(); it != end(); ++it)
-		if ((*it)._renderObject == renderObjectQueueItem._renderObject &&
-			(*it)._version == renderObjectQueueItem._version)
-			return true;
-	return false;
+bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) const {
+	VersionMap::const_iterator it = _versions.find(renderObjectQueueItem._renderObject);
+	return it != _versions.end() && it->_value == renderObjectQueueItem._version;
+}
+
+void RenderObjectQueue::clear() {
+	Common::List<RenderObjectQueueItem>::clear();
+	_versions.clear();
 }
 
 RenderObjectManager::RenderObjectManager(int width, int height, int framebufferCount) :
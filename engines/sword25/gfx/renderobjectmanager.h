@@ -42,6 +42,8 @@
 #ifndef SWORD25_RENDEROBJECTMANAGER_H
 #define SWORD25_RENDEROBJECTMANAGER_H
 
+#include "common/hashmap.h"
+#include "common/hash-ptr.h"
 #include "common/rect.h"
 #include "sword25/kernel/common.h"
 #include "sword25/gfx/renderobjectptr.h"
@@ -67,7 +69,14 @@ struct RenderObjectQueueItem {
 class RenderObjectQueue : public Common::List<RenderObjectQueueItem> {
 public:
 	void add(RenderObject *renderObject);
-	bool exists(const RenderObjectQueueItem &renderObjectQueueItem);
+	bool exists(const RenderObjectQueueItem &renderObjectQueueItem) const;
+	void clear();
+
+private:
+	// The version each queued object was added with, so that comparing the
+	// queues of two frames does not have to walk the list for every object
+	typedef Common::HashMap<RenderObject *, int> VersionMap;
+	VersionMap _versions;
 };
 
 /**
@@ -29,6 +29,8 @@
  *
  */
 
+#include "common/system.h"
+
 #include "sword25/sword25.h"	// for kDebugResource
 #include "sword25/kernel/resmanager.h"
 #include "sword25/kernel/resource.h"
@@ -46,6 +48,11 @@ namespace Sword25 {
 // are loaded, the resource manager will start purging resources till it
 // hits the minimum limit above
 #define SWORD25_RESOURCECACHE_MAX 500
+// The same limits for the memory held by the loaded resources. Most of it
+// is taken by decoded images, so a few large backgrounds can exceed it
+// long before the resource count limit is reached.
+#define SWORD25_RESOURCECACHE_MEMORY_MIN (64 * 1024 * 1024)
+#define SWORD25_RESOURCECACHE_MEMORY_MAX (96 * 1024 * 1024)
 
 ResourceManager::~ResourceManager() {
 	// Clear all unlocked resources
@@ -87,7 +94,7 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
  */
 void ResourceManager::deleteResourcesIfNecessary() {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if (!isCacheAbove(SWORD25_RESOURCECACHE_MAX, SWORD25_RESOURCECACHE_MEMORY_MAX))
 		return;
 
 	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
@@ -98,9 +105,11 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		--iter;
 
 		// The resource may be released only if it isn't locked
-		if ((*iter)->getLockCount() == 0)
+		if ((*iter)->getLockCount() == 0) {
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+			++_evictions;
+		}
+	} while (iter != _resources.begin() && isCacheAbove(SWORD25_RESOURCECACHE_MIN, SWORD25_RESOURCECACHE_MEMORY_MIN));
 
 	// Are we still above the minimum? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
@@ -125,10 +134,15 @@ void ResourceManager::deleteResourcesIfNecessary() {
 				(*iter)->release();
 
 			iter = deleteResource(*iter);
+			++_forcedEvictions;
 		}
 	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
 }
 
+bool ResourceManager::isCacheAbove(uint numResources, uint memory) const {
+	return _resources.size() >= numResources || _usedMemory > memory;
+}
+
 /**
  * Releases all resources that are not locked.
  */
@@ -247,11 +261,19 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 			deleteResourcesIfNecessary();
 
 			// Load the resource
+			uint32 startTime = g_system->getMillis();
 			Resource *pResource = _resourceServices[i]->loadResource(fileName);
 			if (!pResource) {
 				error("Responsible service could not load resource \"%s\".", fileName.c_str());
 				return NULL;
 			}
+			_loadTime += g_system->getMillis() - startTime;
+			++_loads;
+
+			// Remember the size the resource was accounted with, images may
+			// change their content later on
+			pResource->_size = pResource->getSize();
+			_usedMemory += pResource->_size;
 
 			// Add the resource to the front of the list
 			_resources.push_front(pResource);
@@ -296,6 +318,8 @@ Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pRe
 	// Remove the resource from the hash table
 	_resourceHashMap.erase(pResource->_fileName);
 
+	_usedMemory -= pResource->_size;
+
 	// Delete the resource from the resource list
 	Common::List<Resource *>::iterator result = _resources.erase(pResource->_iterator);
 
@@ -320,6 +344,17 @@ Resource *ResourceManager::getResource(const Common::String &uniquefileName) con
 	return NULL;
 }
 
+ResourceManager::Stats ResourceManager::getStats() const {
+	Stats stats;
+	stats.numResources = _resources.size();
+	stats.usedMemory = _usedMemory;
+	stats.loads = _loads;
+	stats.evictions = _evictions;
+	stats.forcedEvictions = _forcedEvictions;
+	stats.loadTime = _loadTime;
+	return stats;
+}
+
 /**
  * Writes the names of all currently locked resources to the log file
  */
@@ -88,13 +88,32 @@ public:
 	 */
 	void dumpLockedResources();
 
+	/**
+	 * Counters describing the state of the resource cache
+	 */
+	struct Stats {
+		uint numResources;
+		uint usedMemory;
+		uint loads;
+		uint evictions;
+		uint forcedEvictions;
+		uint32 loadTime;        ///< Total time spent loading resources, in milliseconds
+	};
+
+	Stats getStats() const;
+
 private:
 	/**
 	 * Creates a new resource manager
 	 * Only the BS_Kernel class can generate copies this class. Thus, the constructor is private
 	 */
 	ResourceManager(Kernel *pKernel) :
-		_kernelPtr(pKernel)
+		_kernelPtr(pKernel),
+		_usedMemory(0),
+		_loads(0),
+		_evictions(0),
+		_forcedEvictions(0),
+		_loadTime(0)
 	{}
 	virtual ~ResourceManager();
 
@@ -134,11 +153,23 @@ private:
 	 */
 	void deleteResourcesIfNecessary();
 
+	/**
+	 * Returns whether the cache holds at least the given number of resources,
+	 * or more than the given number of bytes
+	 */
+	bool isCacheAbove(uint numResources, uint memory) const;
+
 	Kernel *_kernelPtr;
 	Common::Array<ResourceService *> _resourceServices;
 	Common::List<Resource *> _resources;
 	typedef Common::HashMap<Common::String, Resource *> ResMap;
 	ResMap _resourceHashMap;
+
+	uint _usedMemory;
+	uint _loads;
+	uint _evictions;
+	uint _forcedEvictions;
+	uint32 _loadTime;
 };
 
 } // End of namespace Sword25
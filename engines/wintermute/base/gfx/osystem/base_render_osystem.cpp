@@ -40,6 +40,7 @@
 #include "common/config-manager.h"
 
 #define DIRTY_RECT_LIMIT 800
+#define DIRTY_RECT_MAX_COUNT 16
 
 namespace Wintermute {
 
@@ -57,8 +58,8 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
+	memset(&_lastFrameStats, 0, sizeof(_lastFrameStats));
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
 	}
@@ -75,8 +76,6 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
-
 	_renderSurface->free();
 	delete _renderSurface;
 	_blankSurface->free();
@@ -154,8 +153,7 @@ bool BaseRenderOSystem::indicatorFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -194,9 +192,7 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -365,12 +361,40 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect newRect(rect);
+	newRect.clip(_renderRect);
+	if (newRect.isEmpty()) {
+		return;
+	}
+
+	// Merge with any rect it overlaps, or that is close enough that the
+	// bounding rect costs no more to redraw than the two rects would.
+	// A merged rect can touch rects it did not touch before, so rescan.
+	uint i = 0;
+	while (i < _dirtyRects.size()) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+		Common::Rect merged(newRect);
+		merged.extend(dirtyRect);
+		int32 separateArea = (int32)newRect.width() * newRect.height() + (int32)dirtyRect.width() * dirtyRect.height();
+		if (newRect.intersects(dirtyRect) || (int32)merged.width() * merged.height() <= separateArea) {
+			newRect = merged;
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+	_dirtyRects.push_back(newRect);
+
+	// Too many rects make the per-rect overhead outweigh the saved pixels.
+	if (_dirtyRects.size() > DIRTY_RECT_MAX_COUNT) {
+		Common::Rect bounds(_dirtyRects[0]);
+		for (i = 1; i < _dirtyRects.size(); i++) {
+			bounds.extend(_dirtyRects[i]);
+		}
+		_dirtyRects.clear();
+		_dirtyRects.push_back(bounds);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -389,7 +413,13 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+
+	_lastFrameStats.queuedTickets = _renderQueue.size();
+	_lastFrameStats.ticketDraws = 0;
+	_lastFrameStats.dirtyRects = _dirtyRects.size();
+	_lastFrameStats.dirtyPixels = 0;
+
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -399,43 +429,52 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
+
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+	RenderTicket *opaqueTicket = nullptr;
+	if (!_renderQueue.empty() && _renderQueue.front() == _renderQueue.back() && _renderQueue.front()->_transform._alphaDisable == true) {
+		opaqueTicket = _renderQueue.front();
+	}
+
+	Common::Rect dirtyBounds(_dirtyRects[0]);
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+		dirtyBounds.extend(dirtyRect);
+		// If our single opaque rect covers the dirty rect, we can skip filling.
+		if (!opaqueTicket || !opaqueTicket->_dstRect.contains(dirtyRect)) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+		_lastFrameStats.dirtyPixels += (uint32)dirtyRect.width() * dirtyRect.height();
 	}
-	for (; it != _renderQueue.end(); ++it) {
+
+	// Walk the queue once, in order, and redraw each ticket into the dirty
+	// rects it touches. The bounds test rejects most tickets without looking
+	// at the individual rects.
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+		if (!ticket->_dstRect.intersects(dirtyBounds)) {
+			continue;
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			if (ticket->_dstRect.intersects(_dirtyRects[i])) {
+				drawTicketClipped(ticket, _dirtyRects[i]);
+			}
+		}
+	}
+
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+	}
+
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -452,6 +491,23 @@ void BaseRenderOSystem::drawTickets() {
 
 }
 
+void BaseRenderOSystem::drawTicketClipped(RenderTicket *ticket, const Common::Rect &dirtyRect) {
+	// dstClip is the area we want redrawn.
+	Common::Rect dstClip(ticket->_dstRect);
+	// reduce it to the dirty rect
+	dstClip.clip(dirtyRect);
+	// we need to keep track of the position to redraw the dirty rect
+	Common::Rect pos(dstClip);
+	int16 offsetX = ticket->_dstRect.left;
+	int16 offsetY = ticket->_dstRect.top;
+	// convert from screen-coords to surface-coords.
+	dstClip.translate(-offsetX, -offsetY);
+
+	drawFromSurface(ticket, &pos, &dstClip);
+	_lastFrameStats.ticketDraws++;
+	_needsFlip = true;
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void BaseRenderOSystem::drawFromSurface(RenderTicket *ticket) {
 	ticket->drawToSurface(_renderSurface);
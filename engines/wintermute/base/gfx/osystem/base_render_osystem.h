@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
+#include "common/array.h"
 #include "common/list.h"
 #include "graphics/transform_struct.h"
 
@@ -112,6 +113,17 @@ public:
 	void endSaveLoad();
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
 	BaseSurface *createSurface() override;
+
+	/**
+	 * Counters describing the work done for the last frame, for the debugger.
+	 */
+	struct FrameStats {
+		uint32 queuedTickets;
+		uint32 ticketDraws;
+		uint32 dirtyRects;
+		uint32 dirtyPixels;
+	};
+	const FrameStats &getLastFrameStats() const { return _lastFrameStats; }
 private:
 	/**
 	 * Mark a specified rect of the screen as dirty.
@@ -122,12 +134,22 @@ private:
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Redraw the part of a ticket that lies within a dirty rect
+	 */
+	void drawTicketClipped(RenderTicket *ticket, const Common::Rect &dirtyRect);
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	/**
+	 * The dirty region of the screen, as a small set of rects. Rects that
+	 * overlap, or would be cheap to merge, are merged when added; if the set
+	 * grows beyond DIRTY_RECT_MAX_COUNT it collapses into its bounding rect.
+	 */
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	FrameStats _lastFrameStats;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
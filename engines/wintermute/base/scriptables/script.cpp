@@ -237,7 +237,7 @@ bool ScScript::initTables() {
 
 
 //////////////////////////////////////////////////////////////////////////
-bool ScScript::create(const char *filename, byte *buffer, uint32 size, BaseScriptHolder *owner) {
+bool ScScript::create(const char *filename, const ScScriptBuffer &buffer, uint32 size, BaseScriptHolder *owner) {
 	cleanup();
 
 	_thread = false;
@@ -251,13 +251,8 @@ bool ScScript::create(const char *filename, byte *buffer, uint32 size, BaseScrip
 		strcpy(_filename, filename);
 	}
 
-	_buffer = new byte [size];
-	if (!_buffer) {
-		return STATUS_FAILED;
-	}
-
-	memcpy(_buffer, buffer, size);
-
+	_sharedBuffer = buffer;
+	_buffer = _sharedBuffer.get();
 	_bufferSize = size;
 
 	bool res = initScript();
@@ -291,13 +286,9 @@ bool ScScript::createThread(ScScript *original, uint32 initIP, const Common::Str
 		strcpy(_filename, original->_filename);
 	}
 
-	// copy buffer
-	_buffer = new byte [original->_bufferSize];
-	if (!_buffer) {
-		return STATUS_FAILED;
-	}
-
-	memcpy(_buffer, original->_buffer, original->_bufferSize);
+	// share buffer
+	_sharedBuffer = original->_sharedBuffer;
+	_buffer = _sharedBuffer.get();
 	_bufferSize = original->_bufferSize;
 
 	// initialize
@@ -348,13 +339,9 @@ bool ScScript::createMethodThread(ScScript *original, const Common::String &meth
 		strcpy(_filename, original->_filename);
 	}
 
-	// copy buffer
-	_buffer = new byte [original->_bufferSize];
-	if (!_buffer) {
-		return STATUS_FAILED;
-	}
-
-	memcpy(_buffer, original->_buffer, original->_bufferSize);
+	// share buffer
+	_sharedBuffer = original->_sharedBuffer;
+	_buffer = _sharedBuffer.get();
 	_bufferSize = original->_bufferSize;
 
 	// initialize
@@ -382,9 +369,7 @@ bool ScScript::createMethodThread(ScScript *original, const Common::String &meth
 
 //////////////////////////////////////////////////////////////////////////
 void ScScript::cleanup() {
-	if (_buffer) {
-		delete[] _buffer;
-	}
+	_sharedBuffer.reset();
 	_buffer = nullptr;
 
 	if (_filename) {
@@ -1266,7 +1251,8 @@ bool ScScript::persist(BasePersistenceManager *persistMgr) {
 	} else {
 		persistMgr->transferUint32(TMEMBER(_bufferSize));
 		if (_bufferSize > 0) {
-			_buffer = new byte[_bufferSize];
+			_sharedBuffer = ScScriptBuffer(new byte[_bufferSize], ScScriptBufferDeleter());
+			_buffer = _sharedBuffer.get();
 			persistMgr->getBytes(_buffer, _bufferSize);
 			_scriptStream = new Common::MemoryReadStream(_buffer, _bufferSize);
 			initTables();
@@ -1450,15 +1436,16 @@ bool ScScript::finishThreads() {
 //////////////////////////////////////////////////////////////////////////
 void ScScript::afterLoad() {
 	if (_buffer == nullptr) {
-		byte *buffer = _engine->getCompiledScript(_filename, &_bufferSize);
-		if (!buffer) {
+		ScEngine::CScCachedScript *cachedScript = _engine->getCachedScript(_filename);
+		if (!cachedScript) {
 			_gameRef->LOG(0, "Error reinitializing script '%s' after load. Script will be terminated.", _filename);
 			_state = SCRIPT_ERROR;
 			return;
 		}
 
-		_buffer = new byte [_bufferSize];
-		memcpy(_buffer, buffer, _bufferSize);
+		_sharedBuffer = cachedScript->_buffer;
+		_buffer = _sharedBuffer.get();
+		_bufferSize = cachedScript->_size;
 
 		delete _scriptStream;
 		_scriptStream = new Common::MemoryReadStream(_buffer, _bufferSize);
@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/persistent.h"
+#include "common/ptr.h"
 
 namespace Wintermute {
 class BaseScriptHolder;
@@ -42,6 +43,16 @@ class ScEngine;
 class ScStack;
 class ScValue;
 
+struct ScScriptBufferDeleter {
+	void operator()(byte *buffer) { delete[] buffer; }
+};
+
+/**
+ * Compiled script code. It is never modified once loaded, so all scripts
+ * running the same file share one buffer.
+ */
+typedef Common::SharedPtr<byte> ScScriptBuffer;
+
 class ScScript : public BaseClass {
 public:
 	BaseArray<int> _breakpoints;
@@ -133,12 +144,13 @@ public:
 	uint32 getDWORD();
 	double getFloat();
 	void cleanup();
-	bool create(const char *filename, byte *buffer, uint32 size, BaseScriptHolder *owner);
+	bool create(const char *filename, const ScScriptBuffer &buffer, uint32 size, BaseScriptHolder *owner);
 	uint32 _iP;
 private:
 	void readHeader();
 	uint32 _bufferSize;
 	byte *_buffer;
+	ScScriptBuffer _sharedBuffer;
 public:
 	Common::SeekableReadStream *_scriptStream;
 	ScScript(BaseGame *inGame, ScEngine *engine);
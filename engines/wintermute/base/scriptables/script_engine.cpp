@@ -68,9 +68,8 @@ ScEngine::ScEngine(BaseGame *inGame) : BaseClass(inGame) {
 	}
 
 	// prepare script cache
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		_cachedScripts[i] = nullptr;
-	}
+	_cachedScriptsSize = 0;
+	memset(&_cacheStats, 0, sizeof(_cacheStats));
 
 	_currentScript = nullptr;
 
@@ -134,12 +133,9 @@ void ScEngine::parseElement(void *data, int line, int type, void *elementData) {
 
 //////////////////////////////////////////////////////////////////////////
 ScScript *ScEngine::runScript(const char *filename, BaseScriptHolder *owner) {
-	byte *compBuffer;
-	uint32 compSize;
-
 	// get script from cache
-	compBuffer = getCompiledScript(filename, &compSize);
-	if (!compBuffer) {
+	CScCachedScript *cachedScript = getCachedScript(filename);
+	if (!cachedScript) {
 		return nullptr;
 	}
 
@@ -153,7 +149,7 @@ ScScript *ScEngine::runScript(const char *filename, BaseScriptHolder *owner) {
 #else
 	ScScript *script = new ScScript(_gameRef, this);
 #endif
-	bool ret = script->create(filename, compBuffer, compSize, owner);
+	bool ret = script->create(filename, cachedScript->_buffer, cachedScript->_size, owner);
 	if (DID_FAIL(ret)) {
 		_gameRef->LOG(ret, "Error running script '%s'...", filename);
 		delete script;
@@ -179,20 +175,28 @@ ScScript *ScEngine::runScript(const char *filename, BaseScriptHolder *owner) {
 
 //////////////////////////////////////////////////////////////////////////
 byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache) {
+	CScCachedScript *cachedScript = getCachedScript(filename, ignoreCache);
+	if (!cachedScript) {
+		return nullptr;
+	}
+
+	*outSize = cachedScript->_size;
+	return cachedScript->_buffer.get();
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScEngine::CScCachedScript *ScEngine::getCachedScript(const char *filename, bool ignoreCache) {
 	// is script in cache?
-	if (!ignoreCache) {
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] && scumm_stricmp(_cachedScripts[i]->_filename.c_str(), filename) == 0) {
-				_cachedScripts[i]->_timestamp = g_system->getMillis();
-				*outSize = _cachedScripts[i]->_size;
-				return _cachedScripts[i]->_buffer;
-			}
-		}
+	CachedScripts::iterator it = _cachedScripts.find(filename);
+	if (!ignoreCache && it != _cachedScripts.end()) {
+		it->_value->_timestamp = g_system->getMillis();
+		_cacheStats.hits++;
+		return it->_value;
 	}
 
 	// nope, load it
-	byte *compBuffer;
-	uint32 compSize;
+	_cacheStats.misses++;
 
 	uint32 size;
 
@@ -203,10 +207,7 @@ byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ig
 	}
 
 	// needs to be compiled?
-	if (FROM_LE_32(*(uint32 *)buffer) == SCRIPT_MAGIC) {
-		compBuffer = buffer;
-		compSize = size;
-	} else {
+	if (FROM_LE_32(*(uint32 *)buffer) != SCRIPT_MAGIC) {
 		if (!_compilerAvailable) {
 			_gameRef->LOG(0, "ScEngine::GetCompiledScript - script '%s' needs to be compiled but compiler is not available", filename);
 			delete[] buffer;
@@ -217,40 +218,53 @@ byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ig
 		error("Script needs compilation, ScummVM does not contain a WME compiler");
 	}
 
-	byte *ret = nullptr;
-
-	// add script to cache
-	CScCachedScript *cachedScript = new CScCachedScript(filename, compBuffer, compSize);
-	if (cachedScript) {
-		int index = 0;
-		uint32 minTime = g_system->getMillis();
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] == nullptr) {
-				index = i;
-				break;
-			} else if (_cachedScripts[i]->_timestamp <= minTime) {
-				minTime = _cachedScripts[i]->_timestamp;
-				index = i;
-			}
-		}
+	// replace a stale copy of the same script
+	if (it != _cachedScripts.end()) {
+		_cachedScriptsSize -= it->_value->_size;
+		delete it->_value;
+		_cachedScripts.erase(it);
+	}
 
-		if (_cachedScripts[index] != nullptr) {
-			delete _cachedScripts[index];
-		}
-		_cachedScripts[index] = cachedScript;
+	// add script to cache, the buffer is kept as it is
+	CScCachedScript *cachedScript = new CScCachedScript(filename, buffer, size);
+	_cachedScripts[filename] = cachedScript;
+	_cachedScriptsSize += size;
 
-		ret = cachedScript->_buffer;
-		*outSize = cachedScript->_size;
-	}
+	trimScriptCache(cachedScript);
 
+	return cachedScript;
+}
 
-	// cleanup
-	delete[] buffer;
 
-	return ret;
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::trimScriptCache(const CScCachedScript *keep) {
+	// Drop the least recently used scripts until the cache fits its budget.
+	// Running scripts hold their own reference to the buffer, so evicting
+	// only means the next runScript() of that file reloads it.
+	while (_cachedScriptsSize > SCRIPT_CACHE_BUDGET && _cachedScripts.size() > 1) {
+		CachedScripts::iterator oldest = _cachedScripts.end();
+		for (CachedScripts::iterator it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+			if (it->_value != keep && (oldest == _cachedScripts.end() || it->_value->_timestamp < oldest->_value->_timestamp)) {
+				oldest = it;
+			}
+		}
+
+		_cachedScriptsSize -= oldest->_value->_size;
+		delete oldest->_value;
+		_cachedScripts.erase(oldest);
+		_cacheStats.evictions++;
+	}
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScEngine::ScriptCacheStats ScEngine::getScriptCacheStats() const {
+	ScriptCacheStats stats = _cacheStats;
+	stats.numScripts = _cachedScripts.size();
+	stats.size = _cachedScriptsSize;
+	return stats;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::tick() {
@@ -454,12 +468,11 @@ int ScEngine::getNumScripts(int *running, int *waiting, int *persistent) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::emptyScriptCache() {
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		if (_cachedScripts[i]) {
-			delete _cachedScripts[i];
-			_cachedScripts[i] = nullptr;
-		}
+	for (CachedScripts::iterator it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+		delete it->_value;
 	}
+	_cachedScripts.clear();
+	_cachedScriptsSize = 0;
 	return STATUS_OK;
 }
 
@@ -32,10 +32,12 @@
 #include "engines/wintermute/persistent.h"
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/base/base.h"
+#include "engines/wintermute/base/scriptables/script.h"
+#include "common/hash-str.h"
 
 namespace Wintermute {
 
-#define MAX_CACHED_SCRIPTS 20
+#define SCRIPT_CACHE_BUDGET (2 * 1024 * 1024)
 class ScScript;
 class ScValue;
 class BaseObject;
@@ -44,28 +46,29 @@ class ScEngine : public BaseClass {
 public:
 	class CScCachedScript {
 	public:
+		// Takes ownership of the buffer, which is shared with the scripts
+		// running it and outlives the cache entry if they still need it.
 		CScCachedScript(const char *filename, byte *buffer, uint32 size) {
 			_timestamp = g_system->getMillis();
-			_buffer = new byte[size];
-			if (_buffer) {
-				memcpy(_buffer, buffer, size);
-			}
+			_buffer = ScScriptBuffer(buffer, ScScriptBufferDeleter());
 			_size = size;
 			_filename = filename;
 		};
 
-		~CScCachedScript() {
-			if (_buffer) {
-				delete[] _buffer;
-			}
-		};
-
 		uint32 _timestamp;
-		byte *_buffer;
+		ScScriptBuffer _buffer;
 		uint32 _size;
 		Common::String _filename;
 	};
 
+	struct ScriptCacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 evictions;
+		uint32 numScripts;
+		uint32 size;
+	};
+
 public:
 	bool clearGlobals(bool includingNatives = false);
 	bool tickUnbreakable();
@@ -80,6 +83,8 @@ public:
 	bool resetScript(ScScript *script);
 	bool emptyScriptCache();
 	byte *getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache = false);
+	CScCachedScript *getCachedScript(const char *filename, bool ignoreCache = false);
+	ScriptCacheStats getScriptCacheStats() const;
 	DECLARE_PERSISTENT(ScEngine, BaseClass)
 	bool cleanup();
 	int getNumScripts(int *running = nullptr, int *waiting = nullptr, int *persistent = nullptr);
@@ -107,7 +112,12 @@ public:
 
 private:
 
-	CScCachedScript *_cachedScripts[MAX_CACHED_SCRIPTS];
+	void trimScriptCache(const CScCachedScript *keep);
+
+	typedef Common::HashMap<Common::String, CScCachedScript *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CachedScripts;
+	CachedScripts _cachedScripts;
+	uint32 _cachedScriptsSize;
+	ScriptCacheStats _cacheStats;
 	bool _isProfiling;
 	uint32 _profilingStartTime;
 
@@ -182,7 +182,9 @@ ScValue *ScValue::getProp(const char *name) {
 		ret = _valNative->scGetProperty(name);
 	}
 
-	if (ret == nullptr) {
+	// Most natives never get script-side properties, so skip building the
+	// lookup key when there is nothing to find.
+	if (ret == nullptr && !_valObject.empty()) {
 		_valIter = _valObject.find(name);
 		if (_valIter != _valObject.end()) {
 			ret = _valIter->_value;
@@ -222,9 +224,10 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 	if (DID_FAIL(ret)) {
 		ScValue *newVal = nullptr;
 
-		_valIter = _valObject.find(name);
-		if (_valIter != _valObject.end()) {
-			newVal = _valIter->_value;
+		// Keep a local iterator, copy() may move _valIter when val is this
+		Common::HashMap<Common::String, ScValue *>::iterator it = _valObject.find(name);
+		if (it != _valObject.end()) {
+			newVal = it->_value;
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
@@ -234,7 +237,12 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 		newVal->copy(val, copyWhole);
 		newVal->_isConstVar = setAsConst;
-		_valObject[name] = newVal;
+		// Reuse the slot found above rather than hashing the name again
+		if (it != _valObject.end()) {
+			it->_value = newVal;
+		} else {
+			_valObject[name] = newVal;
+		}
 
 		if (_type != VAL_NATIVE) {
 			_type = VAL_OBJECT;
@@ -743,8 +751,9 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
-			_valObject[orig->_valIter->_key] = new ScValue(_gameRef);
-			_valObject[orig->_valIter->_key]->copy(orig->_valIter->_value);
+			ScValue *newVal = new ScValue(_gameRef);
+			_valObject[orig->_valIter->_key] = newVal;
+			newVal->copy(orig->_valIter->_value);
 			orig->_valIter++;
 		}
 	} else {
@@ -23,6 +23,9 @@
 #include "engines/wintermute/debugger.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_file_manager.h"
+#include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/gfx/osystem/base_render_osystem.h"
+#include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/debugger/debugger_controller.h"
 #include "engines/wintermute/wintermute.h"
@@ -36,6 +39,8 @@ Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
 	registerCmd("show_fps", WRAP_METHOD(Console, Cmd_ShowFps));
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
+	registerCmd("render_stats", WRAP_METHOD(Console, Cmd_RenderStats));
+	registerCmd("script_cache", WRAP_METHOD(Console, Cmd_ScriptCache));
 	registerCmd("help", WRAP_METHOD(Console, Cmd_Help));
 	// Actual (script) debugger commands
 	registerCmd(STEP_CMD, WRAP_METHOD(Console, Cmd_Step));
@@ -308,6 +313,40 @@ bool Console::Cmd_ShowFps(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_RenderStats(int argc, const char **argv) {
+	BaseGame *gameRef = BaseEngine::instance().getGameRef();
+	if (!gameRef || !gameRef->_renderer) {
+		debugPrintf("No renderer active\n");
+		return true;
+	}
+
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(gameRef->_renderer);
+	const BaseRenderOSystem::FrameStats &stats = renderer->getLastFrameStats();
+	debugPrintf("Render queue: %d tickets, %d ticket draws\n", stats.queuedTickets, stats.ticketDraws);
+	debugPrintf("Dirty region: %d rects, %d pixels\n", stats.dirtyRects, stats.dirtyPixels);
+	return true;
+}
+
+bool Console::Cmd_ScriptCache(int argc, const char **argv) {
+	BaseGame *gameRef = BaseEngine::instance().getGameRef();
+	if (!gameRef || !gameRef->_scEngine) {
+		debugPrintf("No script engine active\n");
+		return true;
+	}
+
+	if (argc == 2 && Common::String(argv[1]) == "clear") {
+		gameRef->_scEngine->emptyScriptCache();
+	} else if (argc != 1) {
+		debugPrintf("Usage: %s [clear]\n", argv[0]);
+		return true;
+	}
+
+	ScEngine::ScriptCacheStats stats = gameRef->_scEngine->getScriptCacheStats();
+	debugPrintf("Cached scripts: %d, %d of %d bytes\n", stats.numScripts, stats.size, SCRIPT_CACHE_BUDGET);
+	debugPrintf("Hits: %d, misses: %d, evictions: %d\n", stats.hits, stats.misses, stats.evictions);
+	return true;
+}
+
 bool Console::Cmd_DumpFile(int argc, const char **argv) {
 	if (argc != 3) {
 		debugPrintf("Usage: %s <file path> <output file name>\n", argv[0]);
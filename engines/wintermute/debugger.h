@@ -70,6 +70,14 @@ public:
 	bool Cmd_Help(int argc, const char **argv);
 	bool Cmd_ShowFps(int argc, const char **argv);
 	bool Cmd_DumpFile(int argc, const char **argv);
+	/**
+	 * Print the render queue and dirty region counters of the last frame
+	 */
+	bool Cmd_RenderStats(int argc, const char **argv);
+	/**
+	 * Print the compiled script cache counters
+	 */
+	bool Cmd_ScriptCache(int argc, const char **argv);
 
 #if EXTENDED_DEBUGGER_ENABLED
 	/**
@@ -448,6 +448,14 @@ public:
 
 	void drawCallback_VOID(const Common::Rect &area, const DrawStep &step, const Common::Rect &clip) {}
 
+	/**
+	 * Applies the colors and drawing settings of a draw step, as drawing
+	 * it would, without drawing anything.
+	 *
+	 * @param step Pointer to a DrawStep struct.
+	 */
+	void setStepState(const DrawStep &step, uint32 extra = 0);
+
 	/**
 	 * Draws the specified draw step on the screen.
 	 *
@@ -242,62 +242,113 @@ void ManagedSurface::transBlitFrom(const Surface &src, const Common::Rect &srcRe
 		destPos.x + src.w, destPos.y + src.h), transColor, false, overrideColor);
 }
 
-template<typename TSRC, typename TDEST>
-void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, const Common::Rect &destRect, TSRC transColor, bool flipped, uint overrideColor) {
-	int scaleX = SCALE_THRESHOLD * srcRect.width() / destRect.width();
-	int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
+/**
+ * Blends a single source color component onto a destination component.
+ * The division by 255 is done exactly with shifts.
+ */
+static inline byte blendComponent(byte src, byte dest, uint alpha) {
+	uint v = src * alpha + dest * (255 - alpha);
+	return (byte)((v + 1 + (v >> 8)) >> 8);
+}
+
+/**
+ * Copies the pixels of a line which differ from the transparent color. For
+ * matching formats without an override color, runs of opaque pixels are
+ * copied as a block.
+ */
+template<typename T>
+static inline void transCopyLine(const T *src, T *dest, int width, T transColor) {
+	int x = 0;
+	while (x < width) {
+		while (x < width && src[x] == transColor)
+			++x;
+
+		const int start = x;
+		while (x < width && src[x] != transColor)
+			++x;
+
+		if (x > start)
+			memcpy(dest + start, src + start, (x - start) * sizeof(T));
+	}
+}
+
+template<typename TSRC, typename TDEST, bool SAME_FORMAT>
+void transBlitLines(const Surface &src, const Common::Rect &srcRect, Surface &dest, const Common::Rect &destRect,
+		const Common::Rect &clipRect, int scaleX, int scaleY, TSRC transColor, bool flipped, uint overrideColor) {
 	const Graphics::PixelFormat &srcFormat = src.format;
 	const Graphics::PixelFormat &destFormat = dest.format;
+	const int width = clipRect.width();
+	const int xOffset = clipRect.left - destRect.left;
+	const bool unscaledX = scaleX == SCALE_THRESHOLD && !flipped;
 	byte aSrc, rSrc, gSrc, bSrc;
 	byte rDest, gDest, bDest;
-	double alpha;
 
 	// Loop through drawing output lines
-	for (int destY = destRect.top, scaleYCtr = 0; destY < destRect.bottom; ++destY, scaleYCtr += scaleY) {
-		if (destY < 0 || destY >= dest.h)
+	for (int destY = clipRect.top; destY < clipRect.bottom; ++destY) {
+		const int srcY = (destY - destRect.top) * scaleY / SCALE_THRESHOLD + srcRect.top;
+		const TSRC *srcLine = (const TSRC *)src.getBasePtr(srcRect.left, srcY);
+		TDEST *destLine = (TDEST *)dest.getBasePtr(clipRect.left, destY);
+
+		if (SAME_FORMAT && unscaledX && !overrideColor) {
+			transCopyLine<TSRC>(srcLine + xOffset, (TSRC *)destLine, width, transColor);
 			continue;
-		const TSRC *srcLine = (const TSRC *)src.getBasePtr(srcRect.left, scaleYCtr / SCALE_THRESHOLD + srcRect.top);
-		TDEST *destLine = (TDEST *)dest.getBasePtr(destRect.left, destY);
+		}
 
 		// Loop through drawing the pixels of the row
-		for (int destX = destRect.left, xCtr = 0, scaleXCtr = 0; destX < destRect.right; ++destX, ++xCtr, scaleXCtr += scaleX) {
-			if (destX < 0 || destX >= dest.w)
-				continue;
-
-			TSRC srcVal = srcLine[flipped ? src.w - scaleXCtr / SCALE_THRESHOLD - 1 : scaleXCtr / SCALE_THRESHOLD];
+		for (int x = 0, scaleXCtr = xOffset * scaleX; x < width; ++x, scaleXCtr += scaleX) {
+			const int srcX = scaleXCtr / SCALE_THRESHOLD;
+			const TSRC srcVal = srcLine[flipped ? src.w - srcX - 1 : srcX];
 			if (srcVal == transColor)
 				continue;
 
-			if (srcFormat == destFormat) {
+			if (SAME_FORMAT) {
 				// Matching formats, so we can do a straight copy
-				destLine[xCtr] = overrideColor ? overrideColor : srcVal;
-			} else {
-				// Otherwise we have to manually decode and re-encode each pixel
-				srcFormat.colorToARGB(*srcLine, aSrc, rSrc, gSrc, bSrc);
-				destFormat.colorToRGB(destLine[xCtr], rDest, gDest, bDest);
+				destLine[x] = overrideColor ? overrideColor : srcVal;
+				continue;
+			}
 
-				if (aSrc == 0) {
-					// Completely transparent, so skip
-					continue;
-				} else if (aSrc == 0xff) {
-					// Completely opaque, so copy RGB values over
-					rDest = rSrc;
-					gDest = gSrc;
-					bDest = bSrc;
-				} else {
-					// Partially transparent, so calculate new pixel colors
-					alpha = (double)aSrc / 255.0;
-					rDest = static_cast<byte>((rSrc * alpha) + (rDest * (1.0 - alpha)));
-					gDest = static_cast<byte>((gSrc * alpha) + (gDest * (1.0 - alpha)));
-					bDest = static_cast<byte>((bSrc * alpha) + (bDest * (1.0 - alpha)));
-				}
+			// Otherwise we have to manually decode and re-encode each pixel
+			srcFormat.colorToARGB(srcVal, aSrc, rSrc, gSrc, bSrc);
 
-				destLine[xCtr] = destFormat.ARGBToColor(0xff, rDest, gDest, bDest);
+			if (aSrc == 0) {
+				// Completely transparent, so skip
+				continue;
+			} else if (aSrc == 0xff) {
+				// Completely opaque, so copy RGB values over
+				rDest = rSrc;
+				gDest = gSrc;
+				bDest = bSrc;
+			} else {
+				// Partially transparent, so calculate new pixel colors
+				destFormat.colorToRGB(destLine[x], rDest, gDest, bDest);
+				rDest = blendComponent(rSrc, rDest, aSrc);
+				gDest = blendComponent(gSrc, gDest, aSrc);
+				bDest = blendComponent(bSrc, bDest, aSrc);
 			}
+
+			destLine[x] = destFormat.ARGBToColor(0xff, rDest, gDest, bDest);
 		}
 	}
 }
 
+template<typename TSRC, typename TDEST>
+void transBlit(const Surface &src, const Common::Rect &srcRect, Surface &dest, const Common::Rect &destRect, TSRC transColor, bool flipped, uint overrideColor) {
+	int scaleX = SCALE_THRESHOLD * srcRect.width() / destRect.width();
+	int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
+
+	// Only the part of the destination rect inside the surface gets drawn
+	const int16 left = MAX<int16>(destRect.left, 0), top = MAX<int16>(destRect.top, 0);
+	const int16 right = MIN<int16>(destRect.right, dest.w), bottom = MIN<int16>(destRect.bottom, dest.h);
+	if (left >= right || top >= bottom)
+		return;
+	const Common::Rect clipRect(left, top, right, bottom);
+
+	if (src.format == dest.format)
+		transBlitLines<TSRC, TDEST, true>(src, srcRect, dest, destRect, clipRect, scaleX, scaleY, transColor, flipped, overrideColor);
+	else
+		transBlitLines<TSRC, TDEST, false>(src, srcRect, dest, destRect, clipRect, scaleX, scaleY, transColor, flipped, overrideColor);
+}
+
 #define HANDLE_BLIT(SRC_BYTES, DEST_BYTES, SRC_TYPE, DEST_TYPE) \
 	if (src.format.bytesPerPixel == SRC_BYTES && format.bytesPerPixel == DEST_BYTES) \
 		transBlit<SRC_TYPE, DEST_TYPE>(src, srcRect, _innerSurface, destRect, transColor, flipped, overrideColor); \
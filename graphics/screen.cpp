@@ -27,6 +27,12 @@
 
 namespace Graphics {
 
+/**
+ * Number of extra pixels worth copying to the screen to save a call to
+ * copyRectToScreen
+ */
+#define DIRTY_RECT_MERGE_AREA (32 * 32)
+
 Screen::Screen(): ManagedSurface() {
 	create(g_system->getWidth(), g_system->getHeight(), g_system->getScreenFormat());
 }
@@ -63,7 +69,10 @@ void Screen::addDirtyRect(const Common::Rect &r) {
 	bounds.clip(getBounds());
 	bounds.translate(getOffsetFromOwner().x, getOffsetFromOwner().y);
 
-	if (bounds.width() > 0 && bounds.height() > 0)
+	// Engines often mark the same area repeatedly, so skip rects already
+	// covered by the previous one
+	if (bounds.width() > 0 && bounds.height() > 0 &&
+			(_dirtyRects.empty() || !_dirtyRects.back().contains(bounds)))
 		_dirtyRects.push_back(bounds);
 }
 
@@ -74,23 +83,39 @@ void Screen::makeAllDirty() {
 void Screen::mergeDirtyRects() {
 	Common::List<Common::Rect>::iterator rOuter, rInner;
 
-	// Process the dirty rect list to find any rects to merge
+	// Process the dirty rect list to find any rects to merge. Once a rect
+	// has grown it may also have to absorb rects which were checked before,
+	// so it is checked against the whole list until nothing merges into it.
 	for (rOuter = _dirtyRects.begin(); rOuter != _dirtyRects.end(); ++rOuter) {
-		rInner = rOuter;
-		while (++rInner != _dirtyRects.end()) {
+		bool merged;
+		do {
+			merged = false;
+
+			for (rInner = _dirtyRects.begin(); rInner != _dirtyRects.end(); ) {
+				if (rInner != rOuter && shouldMergeRects(*rOuter, *rInner)) {
+					unionRectangle(*rOuter, *rOuter, *rInner);
+					rInner = _dirtyRects.erase(rInner);
+					merged = true;
+				} else {
+					++rInner;
+				}
+			}
+		} while (merged);
+	}
+}
 
-			if ((*rOuter).intersects(*rInner)) {
-				// These two rectangles overlap, so merge them
-				unionRectangle(*rOuter, *rOuter, *rInner);
+bool Screen::shouldMergeRects(const Common::Rect &r1, const Common::Rect &r2) const {
+	// Overlapping rects are always merged, so no area is copied twice
+	if (r1.intersects(r2))
+		return true;
 
-				// remove the inner rect from the list
-				_dirtyRects.erase(rInner);
+	// Otherwise merge when the union does not add too many unchanged pixels,
+	// which includes rects lying side by side
+	Common::Rect u = r1;
+	u.extend(r2);
 
-				// move back to beginning of list
-				rInner = rOuter;
-			}
-		}
-	}
+	int wasted = u.width() * u.height() - r1.width() * r1.height() - r2.width() * r2.height();
+	return wasted <= DIRTY_RECT_MERGE_AREA;
 }
 
 bool Screen::unionRectangle(Common::Rect &destRect, const Common::Rect &src1, const Common::Rect &src2) {
@@ -47,10 +47,16 @@ private:
 	Common::List<Common::Rect> _dirtyRects;
 private:
 	/**
-	* Merges together overlapping dirty areas of the screen
+	* Merges together overlapping, adjacent and nearby dirty areas of the screen
 	*/
 	void mergeDirtyRects();
 
+	/**
+	* Returns true if copying the union of the two rects to the screen is
+	* expected to be cheaper than copying them separately
+	*/
+	bool shouldMergeRects(const Common::Rect &r1, const Common::Rect &r2) const;
+
 	/**
 	* Returns the union of two dirty area rectangles
 	*/
@@ -74,6 +74,224 @@ struct TextColorData {
 	int r, g, b;
 };
 
+/**
+ * Cache of rendered widgets.
+ *
+ * Dialogs redraw the same widgets at the same place over and over, e.g.
+ * when a child dialog closes or the mouse moves over a button. Each entry
+ * keeps the pixels under the widget before and after it was drawn, so a
+ * widget is only blitted from the cache when it is drawn on exactly the
+ * same background as before. Shadows and antialiased edges blend with the
+ * background, so a rendering is never reused on a different one. Widgets
+ * are only cached once they were drawn at the same place twice, so that
+ * widgets drawn only once do not pay for copying their background.
+ */
+class WidgetCache {
+public:
+	WidgetCache() : _useCounter(0), _size(0), _hits(0), _misses(0), _pendingEntry(nullptr), _pendingValid(false) {}
+	~WidgetCache() { clear(); }
+
+	/**
+	 * Draws the widget from the cache if it has been rendered on the same
+	 * background before. Otherwise the current background is remembered
+	 * for the following call to store().
+	 */
+	bool draw(Graphics::Surface &surface, DrawData type, uint32 dynamic, const Common::Rect &area, const Common::Rect &rect);
+
+	/**
+	 * Stores the widget rendering prepared by the last draw() call.
+	 */
+	void store(Graphics::Surface &surface);
+
+	void clear();
+	void printStats();
+
+private:
+	enum {
+		/** Memory used by the cached renderings at most */
+		kCacheBudget = 2 * 1024 * 1024,
+		/** Number of widgets drawn once remembered at most */
+		kMaxMissedKeys = 256
+	};
+
+	struct Key {
+		const Graphics::Surface *surface;
+		DrawData type;
+		uint32 dynamic;
+		Common::Rect area;
+
+		bool operator==(const Key &k) const {
+			return surface == k.surface && type == k.type && dynamic == k.dynamic && area == k.area;
+		}
+	};
+
+	struct KeyHash {
+		uint operator()(const Key &k) const {
+			uint hash = (uint)k.type;
+			hash = hash * 31 + k.dynamic;
+			hash = hash * 31 + (uint16)k.area.left;
+			hash = hash * 31 + (uint16)k.area.top;
+			hash = hash * 31 + (uint16)k.area.right;
+			hash = hash * 31 + (uint16)k.area.bottom;
+			return hash;
+		}
+	};
+
+	struct KeyEqualTo {
+		bool operator()(const Key &k1, const Key &k2) const { return k1 == k2; }
+	};
+
+	struct Entry {
+		Common::Rect rect;
+		Graphics::Surface before;
+		Graphics::Surface after;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<Key, Entry *, KeyHash, KeyEqualTo> EntryMap;
+	typedef Common::HashMap<Key, bool, KeyHash, KeyEqualTo> MissedKeyMap;
+
+	static void copyFromSurface(Graphics::Surface &dst, const Graphics::Surface &src, const Common::Rect &rect);
+	static bool matchesSurface(const Graphics::Surface &cached, const Graphics::Surface &src, const Common::Rect &rect);
+	static uint32 getEntrySize(const Entry *entry);
+	static void freeEntry(Entry *entry);
+	void evict();
+
+	EntryMap _entries;
+	MissedKeyMap _missedKeys;
+	uint32 _useCounter;
+	uint32 _size;
+	uint32 _hits;
+	uint32 _misses;
+
+	Key _pendingKey;
+	Entry *_pendingEntry;
+	bool _pendingValid;
+};
+
+bool WidgetCache::draw(Graphics::Surface &surface, DrawData type, uint32 dynamic, const Common::Rect &area, const Common::Rect &rect) {
+	Key key;
+	key.surface = &surface;
+	key.type = type;
+	key.dynamic = dynamic;
+	key.area = area;
+
+	EntryMap::iterator i = _entries.find(key);
+	if (i != _entries.end() && i->_value->rect == rect && matchesSurface(i->_value->before, surface, rect)) {
+		const Graphics::Surface &after = i->_value->after;
+		for (int y = 0; y < rect.height(); ++y)
+			memcpy(surface.getBasePtr(rect.left, rect.top + y), after.getBasePtr(0, y), rect.width() * surface.format.bytesPerPixel);
+
+		i->_value->lastUse = ++_useCounter;
+		++_hits;
+		return true;
+	}
+
+	++_misses;
+
+	// Only start caching a widget the second time it misses
+	if (i == _entries.end() && !_missedKeys.contains(key)) {
+		if (_missedKeys.size() >= kMaxMissedKeys)
+			_missedKeys.clear();
+		_missedKeys[key] = true;
+		return false;
+	}
+	_missedKeys.erase(key);
+
+	// Remember the background, so the rendering can be stored afterwards
+	_pendingKey = key;
+	_pendingEntry = new Entry();
+	_pendingEntry->rect = rect;
+	copyFromSurface(_pendingEntry->before, surface, rect);
+	_pendingValid = true;
+
+	return false;
+}
+
+void WidgetCache::store(Graphics::Surface &surface) {
+	if (!_pendingValid)
+		return;
+	_pendingValid = false;
+
+	Entry *entry = _pendingEntry;
+	copyFromSurface(entry->after, surface, entry->rect);
+	entry->lastUse = ++_useCounter;
+
+	EntryMap::iterator i = _entries.find(_pendingKey);
+	if (i != _entries.end()) {
+		_size -= getEntrySize(i->_value);
+		freeEntry(i->_value);
+		i->_value = entry;
+	} else {
+		_entries[_pendingKey] = entry;
+	}
+
+	_size += getEntrySize(entry);
+	evict();
+}
+
+void WidgetCache::clear() {
+	for (EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i)
+		freeEntry(i->_value);
+	_entries.clear();
+	_missedKeys.clear();
+
+	if (_pendingValid) {
+		freeEntry(_pendingEntry);
+		_pendingValid = false;
+	}
+
+	_size = 0;
+}
+
+void WidgetCache::printStats() {
+	if (_hits == 0 && _misses == 0)
+		return;
+
+	debug(8, "Widget cache: %d hits, %d misses, %d entries using %d bytes", _hits, _misses, _entries.size(), _size);
+	_hits = _misses = 0;
+}
+
+void WidgetCache::copyFromSurface(Graphics::Surface &dst, const Graphics::Surface &src, const Common::Rect &rect) {
+	dst.create(rect.width(), rect.height(), src.format);
+	for (int y = 0; y < rect.height(); ++y)
+		memcpy(dst.getBasePtr(0, y), src.getBasePtr(rect.left, rect.top + y), rect.width() * src.format.bytesPerPixel);
+}
+
+bool WidgetCache::matchesSurface(const Graphics::Surface &cached, const Graphics::Surface &src, const Common::Rect &rect) {
+	for (int y = 0; y < rect.height(); ++y) {
+		if (memcmp(cached.getBasePtr(0, y), src.getBasePtr(rect.left, rect.top + y), rect.width() * src.format.bytesPerPixel))
+			return false;
+	}
+
+	return true;
+}
+
+uint32 WidgetCache::getEntrySize(const Entry *entry) {
+	return entry->before.h * entry->before.pitch + entry->after.h * entry->after.pitch;
+}
+
+void WidgetCache::freeEntry(Entry *entry) {
+	entry->before.free();
+	entry->after.free();
+	delete entry;
+}
+
+void WidgetCache::evict() {
+	// Drop the least recently used renderings until the cache fits its budget
+	while (_size > kCacheBudget && _entries.size() > 1) {
+		EntryMap::iterator oldest = _entries.begin();
+		for (EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i) {
+			if (i->_value->lastUse < oldest->_value->lastUse)
+				oldest = i;
+		}
+
+		_size -= getEntrySize(oldest->_value);
+		freeEntry(oldest->_value);
+		_entries.erase(oldest);
+	}
+}
+
 struct WidgetDrawData {
 	/** List of all the steps needed to draw this widget */
 	Common::List<Graphics::DrawStep> _steps;
@@ -177,6 +395,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 
 	_system = g_system;
 	_parser = new ThemeParser(this);
+	_widgetCache = new WidgetCache();
 	_themeEval = new GUI::ThemeEval();
 
 	_useCursor = false;
@@ -222,6 +441,7 @@ ThemeEngine::~ThemeEngine() {
 	_backBuffer.free();
 
 	unloadTheme();
+	freeThemeSources();
 
 	// Release all graphics surfaces
 	for (ImagesMap::iterator i = _bitmaps.begin(); i != _bitmaps.end(); ++i) {
@@ -244,6 +464,7 @@ ThemeEngine::~ThemeEngine() {
 
 	delete _parser;
 	delete _themeEval;
+	delete _widgetCache;
 	delete[] _cursor;
 }
 
@@ -687,6 +908,7 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 	unloadTheme();
 
 	debug(6, "Loading theme %s", themeId.c_str());
+	uint32 startTime = _system->getMillis();
 
 	if (themeId == "builtin") {
 		_themeOk = loadDefaultXML();
@@ -700,6 +922,8 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 		return;
 	}
 
+	debug(6, "Loaded theme %s in %d ms", themeId.c_str(), _system->getMillis() - startTime);
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		if (_widgets[i] == 0) {
 			warning("Missing data asset: '%s'", kDrawDataDefaults[i].name);
@@ -729,6 +953,7 @@ void ThemeEngine::unloadTheme() {
 	}
 
 	_themeEval->reset();
+	_widgetCache->clear();
 	_themeOk = false;
 }
 
@@ -796,26 +1021,21 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 		return false;
 	}
 
-	Common::ArchiveMemberList members;
-	if (0 == _themeArchive->listMatchingMembers(members, "*.stx")) {
-		warning("Found no STX files for theme '%s'.", themeId.c_str());
+	if (!readThemeSources(themeId))
 		return false;
-	}
 
 	//
-	// Loop over all STX files, load and parse them
+	// Loop over all STX files and parse them
 	//
-	for (Common::ArchiveMemberList::iterator i = members.begin(); i != members.end(); ++i) {
-		assert((*i)->getName().hasSuffix(".stx"));
-
-		if (_parser->loadStream((*i)->createReadStream()) == false) {
-			warning("Failed to load STX file '%s'", (*i)->getDisplayName().c_str());
+	for (uint i = 0; i < _themeSources.size(); ++i) {
+		if (_parser->loadBuffer(_themeSources[i].data, _themeSources[i].size) == false) {
+			warning("Failed to load STX file '%s'", _themeSources[i].name.c_str());
 			_parser->close();
 			return false;
 		}
 
 		if (_parser->parse() == false) {
-			warning("Failed to parse STX file '%s'", (*i)->getDisplayName().c_str());
+			warning("Failed to parse STX file '%s'", _themeSources[i].name.c_str());
 			_parser->close();
 			return false;
 		}
@@ -827,6 +1047,45 @@ bool ThemeEngine::loadThemeXML(const Common::String &themeId) {
 	return true;
 }
 
+bool ThemeEngine::readThemeSources(const Common::String &themeId) {
+	if (!_themeSources.empty())
+		return true;
+
+	Common::ArchiveMemberList members;
+	if (0 == _themeArchive->listMatchingMembers(members, "*.stx")) {
+		warning("Found no STX files for theme '%s'.", themeId.c_str());
+		return false;
+	}
+
+	for (Common::ArchiveMemberList::iterator i = members.begin(); i != members.end(); ++i) {
+		assert((*i)->getName().hasSuffix(".stx"));
+
+		Common::SeekableReadStream *stream = (*i)->createReadStream();
+		if (!stream) {
+			warning("Failed to load STX file '%s'", (*i)->getDisplayName().c_str());
+			freeThemeSources();
+			return false;
+		}
+
+		ThemeSource source;
+		source.name = (*i)->getDisplayName();
+		source.size = stream->size();
+		source.data = (byte *)malloc(source.size);
+		stream->read(source.data, source.size);
+		delete stream;
+
+		_themeSources.push_back(source);
+	}
+
+	return true;
+}
+
+void ThemeEngine::freeThemeSources() {
+	for (uint i = 0; i < _themeSources.size(); ++i)
+		free(_themeSources[i].data);
+	_themeSources.clear();
+}
+
 
 
 /**********************************************************
@@ -859,11 +1118,30 @@ void ThemeEngine::drawDD(DrawData type, const Common::Rect &r, uint32 dynamic, b
 		restoreBackground(extendedRect);
 
 	if (drawData->_layer == _layerToDraw) {
+		// Only widgets drawn without clipping are cached
+		Graphics::TransparentSurface *surface = _vectorRenderer->getActiveSurface();
+		bool cacheable = surface && Common::Rect(surface->w, surface->h).contains(extendedRect) &&
+			(_clip.isEmpty() || _clip.contains(extendedRect));
+
 		Common::List<Graphics::DrawStep>::const_iterator step;
+		if (cacheable && _widgetCache->draw(*surface, type, dynamic, area, extendedRect)) {
+			// Leave the renderer in the same state as drawing the steps
+			// would, since later steps may rely on the colors set here
+			for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
+				_vectorRenderer->setStepState(*step, dynamic);
+			}
+
+			addDirtyRect(extendedRect);
+			return;
+		}
+
 		for (step = drawData->_steps.begin(); step != drawData->_steps.end(); ++step) {
 			_vectorRenderer->drawStepClip(area, _clip, *step, dynamic);
 		}
 
+		if (cacheable)
+			_widgetCache->store(*surface);
+
 		addDirtyRect(extendedRect);
 	}
 }
@@ -1280,6 +1558,8 @@ void ThemeEngine::copyBackBufferToScreen() {
 }
 
 void ThemeEngine::updateScreen() {
+	_widgetCache->printStats();
+
 #ifdef LAYOUT_DEBUG_DIALOG
 	_vectorRenderer->fillSurface();
 	_themeEval->debugDraw(&_screen, _font);
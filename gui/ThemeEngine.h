@@ -24,6 +24,7 @@
 #define GUI_THEME_ENGINE_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/fs.h"
 #include "common/hash-str.h"
 #include "common/hashmap.h"
@@ -49,6 +50,7 @@ class VectorRenderer;
 namespace GUI {
 
 struct WidgetDrawData;
+class WidgetCache;
 struct TextDrawData;
 struct TextColorData;
 class Dialog;
@@ -609,6 +611,17 @@ protected:
 	 */
 	void unloadTheme();
 
+	/**
+	 * Reads all the STX files of the theme archive into memory, unless
+	 * they have been read already.
+	 */
+	bool readThemeSources(const Common::String &themeId);
+
+	/**
+	 * Frees the STX files read by readThemeSources.
+	 */
+	void freeThemeSources();
+
 	const Graphics::Font *loadScalableFont(const Common::String &filename, const Common::String &charset, const int pointsize, Common::String &name);
 	const Graphics::Font *loadFont(const Common::String &filename, Common::String &name);
 	Common::String genCacheFilename(const Common::String &filename) const;
@@ -702,6 +715,9 @@ protected:
 	 */
 	WidgetDrawData *_widgets[kDrawDataMAX];
 
+	/** Renderings of widgets, see drawDD() */
+	WidgetCache *_widgetCache;
+
 	/** Array of all the text fonts that can be drawn. */
 	TextDrawData *_texts[kTextDataMAX];
 
@@ -728,6 +744,18 @@ protected:
 	Common::Archive *_themeArchive;
 	Common::SearchSet _themeFiles;
 
+	struct ThemeSource {
+		Common::String name;
+		byte *data;
+		uint32 size;
+	};
+
+	/**
+	 * Contents of the STX files of the theme. They are kept, so reloading
+	 * the theme on a resolution change does not read the archive again.
+	 */
+	Common::Array<ThemeSource> _themeSources;
+
 	bool _useCursor;
 	int _cursorHotspotX, _cursorHotspotY;
 	enum {
@@ -769,6 +769,14 @@ void SaveLoadChooserGrid::handleCommand(CommandSender *sender, uint32 cmd, uint3
 		const SaveStateDescriptor &desc = _saveList[cmd - 1 + _curPage * _entriesPerPage];
 
 		if (_saveMode) {
+			// The button of a write protected save stays enabled until its
+			// meta infos are loaded, so check it here
+			const int saveSlot = desc.getSaveSlot();
+			if (!desc.getLocked() && !_metaInfos.contains(saveSlot))
+				_metaInfos[saveSlot] = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
+			if (!desc.getLocked() && _metaInfos[saveSlot].getWriteProtectedFlag())
+				return;
+
 			_resultString = desc.getDescription();
 		}
 
@@ -819,6 +827,7 @@ void SaveLoadChooserGrid::handleMouseWheel(int x, int y, int direction) {
 }
 
 void SaveLoadChooserGrid::updateSaveList() {
+	_metaInfos.clear();
 	SaveLoadChooserDialog::updateSaveList();
 	updateSaves();
 	g_gui.scheduleTopDialogRedraw();
@@ -827,6 +836,8 @@ void SaveLoadChooserGrid::updateSaveList() {
 void SaveLoadChooserGrid::open() {
 	SaveLoadChooserDialog::open();
 
+	// Saves may have changed since the dialog was shown last
+	_metaInfos.clear();
 	listSaves();
 	_resultString.clear();
 
@@ -1065,60 +1076,24 @@ void SaveLoadChooserGrid::hideButtons() {
 void SaveLoadChooserGrid::updateSaves() {
 	hideButtons();
 
-	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
-		const uint saveSlot = _saveList[i].getSaveSlot();
+	// Only the saves of the current page and the next one are loaded
+	_pendingMetaInfos.clear();
 
-		SaveStateDescriptor desc =  (_saveList[i].getLocked() ? _saveList[i] : _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot));
+	for (uint i = _curPage * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
 		SlotButton &curButton = _buttons[curNum];
 		curButton.setVisible(true);
-		const Graphics::Surface *thumbnail = desc.getThumbnail();
-		if (thumbnail) {
-			curButton.button->setGfx(desc.getThumbnail());
-		} else {
-			curButton.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
-		}
-		curButton.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
-
-		Common::String tooltip(_("Name: "));
-		tooltip += desc.getDescription();
-
-		if (_saveDateSupport) {
-			const Common::String &saveDate = desc.getSaveDate();
-			if (!saveDate.empty()) {
-				tooltip += "\n";
-				tooltip +=  _("Date: ") + saveDate;
-			}
-
-			const Common::String &saveTime = desc.getSaveTime();
-			if (!saveTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Time: ") + saveTime;
-			}
-		}
 
-		if (_playTimeSupport) {
-			const Common::String &playTime = desc.getPlayTime();
-			if (!playTime.empty()) {
-				tooltip += "\n";
-				tooltip += _("Playtime: ") + playTime;
-			}
-		}
-
-		curButton.button->setTooltip(tooltip);
-
-		// In save mode we disable the button, when it's write protected.
-		// TODO: Maybe we should not display it at all then?
-		if (_saveMode && desc.getWriteProtectedFlag()) {
-			curButton.button->setEnabled(false);
-		} else {
-			curButton.button->setEnabled(true);
-		}
-
-		//that would make it look "disabled" if slot is locked
-		curButton.button->setEnabled(!desc.getLocked());
-		curButton.description->setEnabled(!desc.getLocked());
+		// Show what listSaves returned until the meta infos are loaded
+		const int saveSlot = _saveList[i].getSaveSlot();
+		if (_saveList[i].getLocked() || !_metaInfos.contains(saveSlot))
+			updateSaveButton(curButton, saveSlot, _saveList[i]);
+		else
+			updateSaveButton(curButton, saveSlot, _metaInfos[saveSlot]);
 	}
 
+	queueMetaInfos(_curPage);
+	queueMetaInfos(_curPage + 1);
+
 	const uint numPages = (_entriesPerPage != 0 && !_saveList.empty()) ? ((_saveList.size() + _entriesPerPage - 1) / _entriesPerPage) : 1;
 	_pageDisplay->setLabel(Common::String::format("%u/%u", _curPage + 1, numPages));
 
@@ -1133,6 +1108,80 @@ void SaveLoadChooserGrid::updateSaves() {
 		_nextButton->setEnabled(false);
 }
 
+void SaveLoadChooserGrid::updateSaveButton(SlotButton &button, int saveSlot, const SaveStateDescriptor &desc) {
+	const Graphics::Surface *thumbnail = desc.getThumbnail();
+	if (thumbnail) {
+		button.button->setGfx(desc.getThumbnail());
+	} else {
+		button.button->setGfx(kThumbnailWidth, kThumbnailHeight2, 0, 0, 0);
+	}
+	button.description->setLabel(Common::String::format("%d. %s", saveSlot, desc.getDescription().c_str()));
+
+	Common::String tooltip(_("Name: "));
+	tooltip += desc.getDescription();
+
+	if (_saveDateSupport) {
+		const Common::String &saveDate = desc.getSaveDate();
+		if (!saveDate.empty()) {
+			tooltip += "\n";
+			tooltip +=  _("Date: ") + saveDate;
+		}
+
+		const Common::String &saveTime = desc.getSaveTime();
+		if (!saveTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Time: ") + saveTime;
+		}
+	}
+
+	if (_playTimeSupport) {
+		const Common::String &playTime = desc.getPlayTime();
+		if (!playTime.empty()) {
+			tooltip += "\n";
+			tooltip += _("Playtime: ") + playTime;
+		}
+	}
+
+	button.button->setTooltip(tooltip);
+
+	// In save mode we disable the button, when it's write protected.
+	// TODO: Maybe we should not display it at all then?
+	if (_saveMode && desc.getWriteProtectedFlag()) {
+		button.button->setEnabled(false);
+	} else {
+		button.button->setEnabled(true);
+	}
+
+	//that would make it look "disabled" if slot is locked
+	button.button->setEnabled(!desc.getLocked());
+	button.description->setEnabled(!desc.getLocked());
+}
+
+void SaveLoadChooserGrid::queueMetaInfos(uint page) {
+	for (uint i = page * _entriesPerPage, curNum = 0; i < _saveList.size() && curNum < _entriesPerPage; ++i, ++curNum) {
+		if (!_saveList[i].getLocked() && !_metaInfos.contains(_saveList[i].getSaveSlot()))
+			_pendingMetaInfos.push_back(i);
+	}
+}
+
+void SaveLoadChooserGrid::handleTickle() {
+	if (!_pendingMetaInfos.empty()) {
+		const uint i = _pendingMetaInfos.front();
+		_pendingMetaInfos.pop_front();
+		assert(i < _saveList.size());
+
+		const int saveSlot = _saveList[i].getSaveSlot();
+		_metaInfos[saveSlot] = _metaEngine->querySaveMetaInfos(_target.c_str(), saveSlot);
+
+		if (i >= _curPage * _entriesPerPage && i < (_curPage + 1) * _entriesPerPage) {
+			updateSaveButton(_buttons[i - _curPage * _entriesPerPage], saveSlot, _metaInfos[saveSlot]);
+			g_gui.scheduleTopDialogRedraw();
+		}
+	}
+
+	SaveLoadChooserDialog::handleTickle();
+}
+
 SavenameDialog::SavenameDialog()
 	: Dialog("SavenameDialog") {
 	_title = new StaticTextWidget(this, "SavenameDialog.DescriptionText", Common::String());
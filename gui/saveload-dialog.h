@@ -23,6 +23,9 @@
 #ifndef GUI_SAVELOAD_DIALOG_H
 #define GUI_SAVELOAD_DIALOG_H
 
+#include "common/hashmap.h"
+#include "common/list.h"
+
 #include "gui/dialog.h"
 #include "gui/widgets/list.h"
 
@@ -206,6 +209,7 @@ public:
 protected:
 	virtual void handleCommand(CommandSender *sender, uint32 cmd, uint32 data);
 	virtual void handleMouseWheel(int x, int y, int direction);
+	virtual void handleTickle();
 	virtual void updateSaveList();
 private:
 	virtual int runIntern();
@@ -243,6 +247,21 @@ private:
 	void destroyButtons();
 	void hideButtons();
 	void updateSaves();
+
+	/**
+	 * Show a save on a button. The slot is passed separately, since the
+	 * descriptor of a save whose meta infos could not be loaded has none.
+	 */
+	void updateSaveButton(SlotButton &button, int saveSlot, const SaveStateDescriptor &desc);
+
+	/**
+	 * Meta infos of the saves loaded so far, by save slot. They are loaded
+	 * one at a time in handleTickle(), so the dialog stays responsive.
+	 */
+	Common::HashMap<int, SaveStateDescriptor> _metaInfos;
+	/** Indices in _saveList of the saves whose meta infos are still to be loaded */
+	Common::List<uint> _pendingMetaInfos;
+	void queueMetaInfos(uint page);
 };
 
 #endif // !DISABLE_SAVELOADCHOOSER_GRID
@@ -401,7 +401,7 @@ int IVIPlaneDesc::checkImageSize(unsigned int w, unsigned int h, int log_offset)
 
 /*------------------------------------------------------------------------*/
 
-AVFrame::AVFrame() {
+AVFrame::AVFrame() : _width(0), _height(0), _bufferSize(0) {
 	Common::fill(&_data[0], &_data[AV_NUM_DATA_POINTERS], (uint8 *)nullptr);
 	Common::fill(&_linesize[0], &_linesize[AV_NUM_DATA_POINTERS], 0);
 }
@@ -415,16 +415,25 @@ int AVFrame::setDimensions(uint16 width, uint16 height) {
 }
 
 int AVFrame::getBuffer(int flags) {
-	freeFrame();
+	const int size = _width * _height;
+
+	// Keep the planes of the previous frame if the frame size did not
+	// change, so that playback does not allocate new planes for every frame
+	if (size != _bufferSize) {
+		freeFrame();
+
+		_data[0] = (uint8 *)malloc(size);
+		_data[1] = (uint8 *)malloc(size);
+		_data[2] = (uint8 *)malloc(size);
+		_bufferSize = size;
+	}
 
 	// Luminance channel
-	_data[0] = (uint8 *)calloc(_width * _height, 1);
+	Common::fill(_data[0], _data[0] + size, 0);
 
 	// UV Chroma Channels
-	_data[1] = (uint8 *)malloc(_width * _height);
-	_data[2] = (uint8 *)malloc(_width * _height);
-	Common::fill(_data[1], _data[1] + _width * _height, 0x80);
-	Common::fill(_data[2], _data[2] + _width * _height, 0x80);
+	Common::fill(_data[1], _data[1] + size, 0x80);
+	Common::fill(_data[2], _data[2] + size, 0x80);
 
 	return 0;
 }
@@ -433,6 +442,7 @@ void AVFrame::freeFrame() {
 	avFreeP(&_data[0]);
 	avFreeP(&_data[1]);
 	avFreeP(&_data[2]);
+	_bufferSize = 0;
 }
 
 /*------------------------------------------------------------------------*/
@@ -505,8 +515,7 @@ IndeoDecoderBase::~IndeoDecoderBase() {
 
 int IndeoDecoderBase::decodeIndeoFrame() {
 	int result;
-	AVFrame frameData;
-	AVFrame *frame = &frameData;
+	AVFrame *frame = _ctx._pFrame;
 
 	// Decode the header
 	if (decodePictureHeader() < 0)
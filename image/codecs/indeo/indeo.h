@@ -339,6 +339,11 @@ struct AVFrame {
 	 */
 	int _linesize[AV_NUM_DATA_POINTERS];
 
+	/**
+	 * Size of each allocated plane in bytes
+	 */
+	int _bufferSize;
+
 	/**
 	 * Constructor
 	 */
@@ -0,0 +1,154 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/managed_surface.h"
+
+class ManagedSurfaceTestSuite : public CxxTest::TestSuite
+{
+private:
+	uint32 _seed;
+
+	uint32 nextRandom() {
+		_seed = _seed * 1103515245 + 12345;
+		return _seed >> 8;
+	}
+
+	template<typename T>
+	void fill(Graphics::Surface &surf, uint32 mask, uint32 transColor) {
+		for (int y = 0; y < surf.h; ++y) {
+			T *line = (T *)surf.getBasePtr(0, y);
+			for (int x = 0; x < surf.w; ++x) {
+				// Make sure there are runs of transparent pixels
+				line[x] = (nextRandom() % 4) == 0 ? transColor : (nextRandom() & mask);
+			}
+		}
+	}
+
+	// Straightforward per-pixel version of ManagedSurface::transBlitFrom
+	template<typename TSRC, typename TDEST>
+	void referenceTransBlit(const Graphics::Surface &src, const Common::Rect &srcRect, Graphics::Surface &dest,
+			const Common::Rect &destRect, uint transColor, bool flipped, uint overrideColor) {
+		const int scaleX = 0x100 * srcRect.width() / destRect.width();
+		const int scaleY = 0x100 * srcRect.height() / destRect.height();
+
+		for (int destY = destRect.top; destY < destRect.bottom; ++destY) {
+			for (int destX = destRect.left; destX < destRect.right; ++destX) {
+				if (destX < 0 || destX >= dest.w || destY < 0 || destY >= dest.h)
+					continue;
+
+				const int srcX = (destX - destRect.left) * scaleX / 0x100;
+				const int srcY = (destY - destRect.top) * scaleY / 0x100 + srcRect.top;
+				const TSRC *srcLine = (const TSRC *)src.getBasePtr(srcRect.left, srcY);
+				const TSRC srcVal = srcLine[flipped ? src.w - srcX - 1 : srcX];
+				if (srcVal == (TSRC)transColor)
+					continue;
+
+				TDEST *destVal = (TDEST *)dest.getBasePtr(destX, destY);
+				if (src.format == dest.format) {
+					*destVal = overrideColor ? overrideColor : srcVal;
+					continue;
+				}
+
+				byte a, r, g, b, rDest, gDest, bDest;
+				src.format.colorToARGB(srcVal, a, r, g, b);
+				if (a == 0)
+					continue;
+
+				dest.format.colorToRGB(*destVal, rDest, gDest, bDest);
+				rDest = (r * a + rDest * (255 - a)) / 255;
+				gDest = (g * a + gDest * (255 - a)) / 255;
+				bDest = (b * a + bDest * (255 - a)) / 255;
+				*destVal = dest.format.ARGBToColor(0xff, rDest, gDest, bDest);
+			}
+		}
+	}
+
+	template<typename TSRC, typename TDEST>
+	void transBlitTestTemplate(const Graphics::PixelFormat &srcFormat, const Graphics::PixelFormat &destFormat,
+			uint32 srcMask, uint32 destMask, uint transColor, const Common::Rect &srcRect, const Common::Rect &destRect,
+			bool flipped = false, uint overrideColor = 0) {
+		_seed = 1;
+
+		Graphics::Surface src;
+		src.create(40, 30, srcFormat);
+		fill<TSRC>(src, srcMask, transColor);
+
+		Graphics::Surface expected;
+		expected.create(64, 48, destFormat);
+		fill<TDEST>(expected, destMask, 0);
+
+		Graphics::ManagedSurface dest(64, 48, destFormat);
+		dest.blitFrom(expected);
+
+		referenceTransBlit<TSRC, TDEST>(src, srcRect, expected, destRect, transColor, flipped, overrideColor);
+		dest.transBlitFrom(src, srcRect, destRect, transColor, flipped, overrideColor);
+
+		for (int y = 0; y < expected.h; ++y)
+			TS_ASSERT_EQUALS(memcmp(expected.getBasePtr(0, y), dest.getBasePtr(0, y), expected.w * destFormat.bytesPerPixel), 0);
+
+		src.free();
+		expected.free();
+	}
+
+	void clutTestTemplate(const Common::Rect &srcRect, const Common::Rect &destRect, bool flipped = false, uint overrideColor = 0) {
+		transBlitTestTemplate<byte, byte>(Graphics::PixelFormat::createFormatCLUT8(), Graphics::PixelFormat::createFormatCLUT8(),
+			0xff, 0xff, 5, srcRect, destRect, flipped, overrideColor);
+	}
+
+public:
+	void test_trans_blit_clut8() {
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(3, 5, 43, 35));
+	}
+
+	void test_trans_blit_clut8_sub_rect() {
+		clutTestTemplate(Common::Rect(7, 4, 30, 20), Common::Rect(10, 10, 33, 26));
+	}
+
+	void test_trans_blit_clut8_clipped() {
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(-10, -7, 30, 23));
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(40, 30, 80, 60));
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(-50, 0, -10, 30));
+	}
+
+	void test_trans_blit_clut8_flipped() {
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(-5, 2, 35, 32), true);
+	}
+
+	void test_trans_blit_clut8_override() {
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(30, 20, 70, 50), false, 9);
+	}
+
+	void test_trans_blit_clut8_scaled() {
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(-3, 1, 61, 47));
+		clutTestTemplate(Common::Rect(0, 0, 40, 30), Common::Rect(2, 2, 19, 13), true);
+	}
+
+	void test_trans_blit_rgb565() {
+		const Graphics::PixelFormat format(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		transBlitTestTemplate<uint16, uint16>(format, format, 0xffff, 0xffff, 0xf81f,
+			Common::Rect(0, 0, 40, 30), Common::Rect(30, -4, 70, 26));
+		transBlitTestTemplate<uint16, uint16>(format, format, 0xffff, 0xffff, 0xf81f,
+			Common::Rect(5, 5, 35, 25), Common::Rect(0, 0, 45, 40));
+	}
+
+	void test_trans_blit_argb8888() {
+		const Graphics::PixelFormat format(4, 8, 8, 8, 8, 16, 8, 0, 24);
+		transBlitTestTemplate<uint32, uint32>(format, format, 0xffffffff, 0xffffffff, 0xff00ff00,
+			Common::Rect(0, 0, 40, 30), Common::Rect(-20, 20, 20, 50));
+	}
+
+	void test_trans_blit_argb8888_to_rgb565() {
+		const Graphics::PixelFormat srcFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
+		const Graphics::PixelFormat destFormat(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		transBlitTestTemplate<uint32, uint16>(srcFormat, destFormat, 0xffffffff, 0xffff, 0xff00ff00,
+			Common::Rect(0, 0, 40, 30), Common::Rect(10, 10, 50, 40));
+		transBlitTestTemplate<uint32, uint16>(srcFormat, destFormat, 0xffffffff, 0xffff, 0xff00ff00,
+			Common::Rect(0, 0, 40, 30), Common::Rect(-8, 30, 72, 90), true);
+	}
+
+	void test_trans_blit_rgb565_to_argb8888() {
+		const Graphics::PixelFormat srcFormat(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		const Graphics::PixelFormat destFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
+		transBlitTestTemplate<uint16, uint32>(srcFormat, destFormat, 0xffff, 0xffffffff, 0xf81f,
+			Common::Rect(0, 0, 40, 30), Common::Rect(20, 10, 60, 40));
+	}
+};